@@ -165,96 +165,148 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* The extension names are kept in an open addressing hash set, built once while loading and kept afterwards,
+   so has_ext and gladHasExtension cost one hash and usually one strcmp instead of a scan over every
+   extension the driver lists. The names are copied into a single block. */
+static char *exts_names = NULL;
+static const char **exts_set = NULL;
+static unsigned int exts_set_mask = 0;
+static int num_exts = 0;
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
+static unsigned int hash_ext(const char *ext) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    while(*ext) {
+        hash ^= (unsigned char)*ext++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static void free_exts(void) {
+    free((void *)exts_set);
+    free(exts_names);
+    exts_set = NULL;
+    exts_names = NULL;
+    exts_set_mask = 0;
+    num_exts = 0;
+}
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+static void add_ext(const char *ext) {
+    unsigned int slot = hash_ext(ext) & exts_set_mask;
+    while(exts_set[slot] != NULL) {
+        if(strcmp(exts_set[slot], ext) == 0) {
+            return;
         }
+        slot = (slot + 1) & exts_set_mask;
     }
-#endif
-    return 1;
+    exts_set[slot] = ext;
+    num_exts++;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+/* Sizes the set for count names at no more than half full */
+static int alloc_exts(int count) {
+    unsigned int size = 16;
+    while(size < (unsigned int)count * 2) {
+        size *= 2;
     }
+    exts_set = (const char **)calloc(size, sizeof *exts_set);
+    exts_set_mask = size - 1;
+    return exts_set != NULL;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(void) {
+    free_exts();
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+        size_t len;
+        int count = 1;
+        char *name;
+        if(exts == NULL) {
             return 0;
         }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
+        len = strlen(exts);
+        exts_names = (char *)malloc(len + 1);
+        if(exts_names == NULL) {
+            return 0;
+        }
+        memcpy(exts_names, exts, len + 1);
+        for(name = exts_names; *name; name++) {
+            count += *name == ' ';
+        }
+        if(!alloc_exts(count)) {
+            return 0;
+        }
+        /* The copy is split in place, each space becomes the end of a name */
+        name = exts_names;
+        while(*name) {
+            char *end = strchr(name, ' ');
+            if(end != NULL) {
+                *end = '\0';
             }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+            if(*name) {
+                add_ext(name);
             }
-            extensions = terminator;
+            if(end == NULL) {
+                break;
+            }
+            name = end + 1;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        int count = 0;
+        size_t total = 0;
+        char *next;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        if(count < 0) {
+            count = 0;
+        }
+        for(index = 0; index < count; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            total += gl_str_tmp != NULL ? strlen(gl_str_tmp) + 1 : 0;
+        }
+        exts_names = (char *)malloc(total + 1);
+        if(exts_names == NULL || !alloc_exts(count)) {
+            return 0;
+        }
+        next = exts_names;
+        for(index = 0; index < count; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            size_t len;
+            if(gl_str_tmp == NULL) {
+                continue;
             }
+            len = strlen(gl_str_tmp);
+            memcpy(next, gl_str_tmp, len + 1);
+            add_ext(next);
+            next += len + 1;
         }
     }
 #endif
+    return 1;
+}
 
+static int has_ext(const char *ext) {
+    unsigned int slot;
+    if(exts_set == NULL || ext == NULL) {
+        return 0;
+    }
+    slot = hash_ext(ext) & exts_set_mask;
+    while(exts_set[slot] != NULL) {
+        if(strcmp(exts_set[slot], ext) == 0) {
+            return 1;
+        }
+        slot = (slot + 1) & exts_set_mask;
+    }
     return 0;
 }
+
+int gladHasExtension(const char *name) {
+    return has_ext(name);
+}
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -991,6 +1043,123 @@ PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
 PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
 PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
 PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+int GLAD_GL_ARB_base_instance = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_direct_state_access = 0;
+int GLAD_GL_ARB_draw_indirect = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_ARB_multi_draw_indirect = 0;
+int GLAD_GL_ARB_shader_draw_parameters = 0;
+int GLAD_GL_ARB_texture_storage = 0;
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = NULL;
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = NULL;
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = NULL;
+PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = NULL;
+PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = NULL;
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = NULL;
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
+PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
+PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = NULL;
+PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = NULL;
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = NULL;
+PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = NULL;
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = NULL;
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = NULL;
+PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = NULL;
+PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = NULL;
+PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = NULL;
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = NULL;
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = NULL;
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = NULL;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = NULL;
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = NULL;
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = NULL;
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = NULL;
+PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = NULL;
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = NULL;
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = NULL;
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = NULL;
+PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = NULL;
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = NULL;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = NULL;
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = NULL;
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
+PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = NULL;
+PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = NULL;
+PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = NULL;
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
+PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = NULL;
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = NULL;
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = NULL;
+PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = NULL;
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
+PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = NULL;
+PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = NULL;
+PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = NULL;
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
+PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = NULL;
+PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = NULL;
+PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = NULL;
+PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
+PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = NULL;
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = NULL;
+PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = NULL;
+PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = NULL;
+PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = NULL;
+PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = NULL;
+PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = NULL;
+PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = NULL;
+PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
+PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = NULL;
+PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = NULL;
+PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = NULL;
+PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = NULL;
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = NULL;
+PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = NULL;
+PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = NULL;
+PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = NULL;
+PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = NULL;
+PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = NULL;
+PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = NULL;
+PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = NULL;
+PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = NULL;
+PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = NULL;
+PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = NULL;
+PFNGLCREATEQUERIESPROC glad_glCreateQueries = NULL;
+PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = NULL;
+PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = NULL;
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = NULL;
+PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1754,87 +1923,3907 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
-static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
-	return 1;
+static GLADloadproc lazy_load = NULL;
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)lazy_load("glCullFace");
+	glad_glCullFace(mode);
 }
-
-static void find_coreGL(void) {
-
-    /* Thank you @elmindreda
-     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
-     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
-     */
-    int i, major, minor;
-
-    const char* version;
-    const char* prefixes[] = {
-        "OpenGL ES-CM ",
-        "OpenGL ES-CL ",
-        "OpenGL ES ",
-        NULL
-    };
-
-    version = (const char*) glGetString(GL_VERSION);
-    if (!version) return;
-
-    for (i = 0;  prefixes[i];  i++) {
-        const size_t length = strlen(prefixes[i]);
-        if (strncmp(version, prefixes[i], length) == 0) {
-            version += length;
-            break;
-        }
-    }
-
-/* PR #18 */
-#ifdef _MSC_VER
-    sscanf_s(version, "%d.%d", &major, &minor);
-#else
-    sscanf(version, "%d.%d", &major, &minor);
-#endif
-
-    GLVersion.major = major; GLVersion.minor = minor;
-    max_loaded_major = major; max_loaded_minor = minor;
-	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
-	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
-	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
-	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
-	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
-	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
-	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
-	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
-	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
-	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
-	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
-	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
-	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
-		max_loaded_major = 3;
-		max_loaded_minor = 3;
-	}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)lazy_load("glFrontFace");
+	glad_glFrontFace(mode);
 }
-
-int gladLoadGLLoader(GLADloadproc load) {
-	GLVersion.major = 0; GLVersion.minor = 0;
-	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	if(glGetString == NULL) return 0;
-	if(glGetString(GL_VERSION) == NULL) return 0;
-	find_coreGL();
-	load_GL_VERSION_1_0(load);
-	load_GL_VERSION_1_1(load);
-	load_GL_VERSION_1_2(load);
-	load_GL_VERSION_1_3(load);
-	load_GL_VERSION_1_4(load);
-	load_GL_VERSION_1_5(load);
-	load_GL_VERSION_2_0(load);
-	load_GL_VERSION_2_1(load);
-	load_GL_VERSION_3_0(load);
-	load_GL_VERSION_3_1(load);
-	load_GL_VERSION_3_2(load);
-	load_GL_VERSION_3_3(load);
-
-	if (!find_extensionsGL()) return 0;
-	return GLVersion.major != 0 || GLVersion.minor != 0;
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)lazy_load("glHint");
+	glad_glHint(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)lazy_load("glLineWidth");
+	glad_glLineWidth(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)lazy_load("glPointSize");
+	glad_glPointSize(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)lazy_load("glPolygonMode");
+	glad_glPolygonMode(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)lazy_load("glScissor");
+	glad_glScissor(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)lazy_load("glTexParameterf");
+	glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)lazy_load("glTexParameterfv");
+	glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)lazy_load("glTexParameteri");
+	glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)lazy_load("glTexParameteriv");
+	glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)lazy_load("glTexImage1D");
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)lazy_load("glTexImage2D");
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)lazy_load("glDrawBuffer");
+	glad_glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)lazy_load("glClear");
+	glad_glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)lazy_load("glClearColor");
+	glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)lazy_load("glClearStencil");
+	glad_glClearStencil(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)lazy_load("glClearDepth");
+	glad_glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)lazy_load("glStencilMask");
+	glad_glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)lazy_load("glColorMask");
+	glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)lazy_load("glDepthMask");
+	glad_glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)lazy_load("glDisable");
+	glad_glDisable(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)lazy_load("glEnable");
+	glad_glEnable(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)lazy_load("glFinish");
+	glad_glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)lazy_load("glFlush");
+	glad_glFlush();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)lazy_load("glBlendFunc");
+	glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)lazy_load("glLogicOp");
+	glad_glLogicOp(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)lazy_load("glStencilFunc");
+	glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)lazy_load("glStencilOp");
+	glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)lazy_load("glDepthFunc");
+	glad_glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)lazy_load("glPixelStoref");
+	glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)lazy_load("glPixelStorei");
+	glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)lazy_load("glReadBuffer");
+	glad_glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)lazy_load("glReadPixels");
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)lazy_load("glGetBooleanv");
+	glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)lazy_load("glGetDoublev");
+	glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)lazy_load("glGetError");
+	return glad_glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)lazy_load("glGetFloatv");
+	glad_glGetFloatv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)lazy_load("glGetIntegerv");
+	glad_glGetIntegerv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)lazy_load("glGetTexImage");
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)lazy_load("glGetTexParameterfv");
+	glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)lazy_load("glGetTexParameteriv");
+	glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)lazy_load("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)lazy_load("glGetTexLevelParameteriv");
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)lazy_load("glIsEnabled");
+	return glad_glIsEnabled(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)lazy_load("glDepthRange");
+	glad_glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)lazy_load("glViewport");
+	glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) {
+	glad_glNewList = (PFNGLNEWLISTPROC)lazy_load("glNewList");
+	glad_glNewList(list, mode);
+}
+static void APIENTRY glad_lazy_glEndList(void) {
+	glad_glEndList = (PFNGLENDLISTPROC)lazy_load("glEndList");
+	glad_glEndList();
+}
+static void APIENTRY glad_lazy_glCallList(GLuint list) {
+	glad_glCallList = (PFNGLCALLLISTPROC)lazy_load("glCallList");
+	glad_glCallList(list);
+}
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	glad_glCallLists = (PFNGLCALLLISTSPROC)lazy_load("glCallLists");
+	glad_glCallLists(n, type, lists);
+}
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) {
+	glad_glDeleteLists = (PFNGLDELETELISTSPROC)lazy_load("glDeleteLists");
+	glad_glDeleteLists(list, range);
+}
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) {
+	glad_glGenLists = (PFNGLGENLISTSPROC)lazy_load("glGenLists");
+	return glad_glGenLists(range);
+}
+static void APIENTRY glad_lazy_glListBase(GLuint base) {
+	glad_glListBase = (PFNGLLISTBASEPROC)lazy_load("glListBase");
+	glad_glListBase(base);
+}
+static void APIENTRY glad_lazy_glBegin(GLenum mode) {
+	glad_glBegin = (PFNGLBEGINPROC)lazy_load("glBegin");
+	glad_glBegin(mode);
+}
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	glad_glBitmap = (PFNGLBITMAPPROC)lazy_load("glBitmap");
+	glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glColor3b = (PFNGLCOLOR3BPROC)lazy_load("glColor3b");
+	glad_glColor3b(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) {
+	glad_glColor3bv = (PFNGLCOLOR3BVPROC)lazy_load("glColor3bv");
+	glad_glColor3bv(v);
+}
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glColor3d = (PFNGLCOLOR3DPROC)lazy_load("glColor3d");
+	glad_glColor3d(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) {
+	glad_glColor3dv = (PFNGLCOLOR3DVPROC)lazy_load("glColor3dv");
+	glad_glColor3dv(v);
+}
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glColor3f = (PFNGLCOLOR3FPROC)lazy_load("glColor3f");
+	glad_glColor3f(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) {
+	glad_glColor3fv = (PFNGLCOLOR3FVPROC)lazy_load("glColor3fv");
+	glad_glColor3fv(v);
+}
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) {
+	glad_glColor3i = (PFNGLCOLOR3IPROC)lazy_load("glColor3i");
+	glad_glColor3i(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) {
+	glad_glColor3iv = (PFNGLCOLOR3IVPROC)lazy_load("glColor3iv");
+	glad_glColor3iv(v);
+}
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glColor3s = (PFNGLCOLOR3SPROC)lazy_load("glColor3s");
+	glad_glColor3s(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) {
+	glad_glColor3sv = (PFNGLCOLOR3SVPROC)lazy_load("glColor3sv");
+	glad_glColor3sv(v);
+}
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glColor3ub = (PFNGLCOLOR3UBPROC)lazy_load("glColor3ub");
+	glad_glColor3ub(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) {
+	glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)lazy_load("glColor3ubv");
+	glad_glColor3ubv(v);
+}
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glColor3ui = (PFNGLCOLOR3UIPROC)lazy_load("glColor3ui");
+	glad_glColor3ui(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) {
+	glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)lazy_load("glColor3uiv");
+	glad_glColor3uiv(v);
+}
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glColor3us = (PFNGLCOLOR3USPROC)lazy_load("glColor3us");
+	glad_glColor3us(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) {
+	glad_glColor3usv = (PFNGLCOLOR3USVPROC)lazy_load("glColor3usv");
+	glad_glColor3usv(v);
+}
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	glad_glColor4b = (PFNGLCOLOR4BPROC)lazy_load("glColor4b");
+	glad_glColor4b(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) {
+	glad_glColor4bv = (PFNGLCOLOR4BVPROC)lazy_load("glColor4bv");
+	glad_glColor4bv(v);
+}
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	glad_glColor4d = (PFNGLCOLOR4DPROC)lazy_load("glColor4d");
+	glad_glColor4d(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) {
+	glad_glColor4dv = (PFNGLCOLOR4DVPROC)lazy_load("glColor4dv");
+	glad_glColor4dv(v);
+}
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glColor4f = (PFNGLCOLOR4FPROC)lazy_load("glColor4f");
+	glad_glColor4f(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) {
+	glad_glColor4fv = (PFNGLCOLOR4FVPROC)lazy_load("glColor4fv");
+	glad_glColor4fv(v);
+}
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_glColor4i = (PFNGLCOLOR4IPROC)lazy_load("glColor4i");
+	glad_glColor4i(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) {
+	glad_glColor4iv = (PFNGLCOLOR4IVPROC)lazy_load("glColor4iv");
+	glad_glColor4iv(v);
+}
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	glad_glColor4s = (PFNGLCOLOR4SPROC)lazy_load("glColor4s");
+	glad_glColor4s(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) {
+	glad_glColor4sv = (PFNGLCOLOR4SVPROC)lazy_load("glColor4sv");
+	glad_glColor4sv(v);
+}
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	glad_glColor4ub = (PFNGLCOLOR4UBPROC)lazy_load("glColor4ub");
+	glad_glColor4ub(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) {
+	glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)lazy_load("glColor4ubv");
+	glad_glColor4ubv(v);
+}
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_glColor4ui = (PFNGLCOLOR4UIPROC)lazy_load("glColor4ui");
+	glad_glColor4ui(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) {
+	glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)lazy_load("glColor4uiv");
+	glad_glColor4uiv(v);
+}
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	glad_glColor4us = (PFNGLCOLOR4USPROC)lazy_load("glColor4us");
+	glad_glColor4us(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) {
+	glad_glColor4usv = (PFNGLCOLOR4USVPROC)lazy_load("glColor4usv");
+	glad_glColor4usv(v);
+}
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) {
+	glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)lazy_load("glEdgeFlag");
+	glad_glEdgeFlag(flag);
+}
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) {
+	glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)lazy_load("glEdgeFlagv");
+	glad_glEdgeFlagv(flag);
+}
+static void APIENTRY glad_lazy_glEnd(void) {
+	glad_glEnd = (PFNGLENDPROC)lazy_load("glEnd");
+	glad_glEnd();
+}
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) {
+	glad_glIndexd = (PFNGLINDEXDPROC)lazy_load("glIndexd");
+	glad_glIndexd(c);
+}
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) {
+	glad_glIndexdv = (PFNGLINDEXDVPROC)lazy_load("glIndexdv");
+	glad_glIndexdv(c);
+}
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) {
+	glad_glIndexf = (PFNGLINDEXFPROC)lazy_load("glIndexf");
+	glad_glIndexf(c);
+}
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) {
+	glad_glIndexfv = (PFNGLINDEXFVPROC)lazy_load("glIndexfv");
+	glad_glIndexfv(c);
+}
+static void APIENTRY glad_lazy_glIndexi(GLint c) {
+	glad_glIndexi = (PFNGLINDEXIPROC)lazy_load("glIndexi");
+	glad_glIndexi(c);
+}
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) {
+	glad_glIndexiv = (PFNGLINDEXIVPROC)lazy_load("glIndexiv");
+	glad_glIndexiv(c);
+}
+static void APIENTRY glad_lazy_glIndexs(GLshort c) {
+	glad_glIndexs = (PFNGLINDEXSPROC)lazy_load("glIndexs");
+	glad_glIndexs(c);
+}
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) {
+	glad_glIndexsv = (PFNGLINDEXSVPROC)lazy_load("glIndexsv");
+	glad_glIndexsv(c);
+}
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_glNormal3b = (PFNGLNORMAL3BPROC)lazy_load("glNormal3b");
+	glad_glNormal3b(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) {
+	glad_glNormal3bv = (PFNGLNORMAL3BVPROC)lazy_load("glNormal3bv");
+	glad_glNormal3bv(v);
+}
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_glNormal3d = (PFNGLNORMAL3DPROC)lazy_load("glNormal3d");
+	glad_glNormal3d(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) {
+	glad_glNormal3dv = (PFNGLNORMAL3DVPROC)lazy_load("glNormal3dv");
+	glad_glNormal3dv(v);
+}
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_glNormal3f = (PFNGLNORMAL3FPROC)lazy_load("glNormal3f");
+	glad_glNormal3f(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) {
+	glad_glNormal3fv = (PFNGLNORMAL3FVPROC)lazy_load("glNormal3fv");
+	glad_glNormal3fv(v);
+}
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	glad_glNormal3i = (PFNGLNORMAL3IPROC)lazy_load("glNormal3i");
+	glad_glNormal3i(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) {
+	glad_glNormal3iv = (PFNGLNORMAL3IVPROC)lazy_load("glNormal3iv");
+	glad_glNormal3iv(v);
+}
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	glad_glNormal3s = (PFNGLNORMAL3SPROC)lazy_load("glNormal3s");
+	glad_glNormal3s(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) {
+	glad_glNormal3sv = (PFNGLNORMAL3SVPROC)lazy_load("glNormal3sv");
+	glad_glNormal3sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+	glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)lazy_load("glRasterPos2d");
+	glad_glRasterPos2d(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) {
+	glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)lazy_load("glRasterPos2dv");
+	glad_glRasterPos2dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+	glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)lazy_load("glRasterPos2f");
+	glad_glRasterPos2f(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) {
+	glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)lazy_load("glRasterPos2fv");
+	glad_glRasterPos2fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) {
+	glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)lazy_load("glRasterPos2i");
+	glad_glRasterPos2i(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) {
+	glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)lazy_load("glRasterPos2iv");
+	glad_glRasterPos2iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) {
+	glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)lazy_load("glRasterPos2s");
+	glad_glRasterPos2s(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) {
+	glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)lazy_load("glRasterPos2sv");
+	glad_glRasterPos2sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)lazy_load("glRasterPos3d");
+	glad_glRasterPos3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) {
+	glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)lazy_load("glRasterPos3dv");
+	glad_glRasterPos3dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)lazy_load("glRasterPos3f");
+	glad_glRasterPos3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) {
+	glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)lazy_load("glRasterPos3fv");
+	glad_glRasterPos3fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+	glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)lazy_load("glRasterPos3i");
+	glad_glRasterPos3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) {
+	glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)lazy_load("glRasterPos3iv");
+	glad_glRasterPos3iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)lazy_load("glRasterPos3s");
+	glad_glRasterPos3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) {
+	glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)lazy_load("glRasterPos3sv");
+	glad_glRasterPos3sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)lazy_load("glRasterPos4d");
+	glad_glRasterPos4d(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) {
+	glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)lazy_load("glRasterPos4dv");
+	glad_glRasterPos4dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)lazy_load("glRasterPos4f");
+	glad_glRasterPos4f(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) {
+	glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)lazy_load("glRasterPos4fv");
+	glad_glRasterPos4fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)lazy_load("glRasterPos4i");
+	glad_glRasterPos4i(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) {
+	glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)lazy_load("glRasterPos4iv");
+	glad_glRasterPos4iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)lazy_load("glRasterPos4s");
+	glad_glRasterPos4s(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) {
+	glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)lazy_load("glRasterPos4sv");
+	glad_glRasterPos4sv(v);
+}
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	glad_glRectd = (PFNGLRECTDPROC)lazy_load("glRectd");
+	glad_glRectd(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	glad_glRectdv = (PFNGLRECTDVPROC)lazy_load("glRectdv");
+	glad_glRectdv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	glad_glRectf = (PFNGLRECTFPROC)lazy_load("glRectf");
+	glad_glRectf(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	glad_glRectfv = (PFNGLRECTFVPROC)lazy_load("glRectfv");
+	glad_glRectfv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	glad_glRecti = (PFNGLRECTIPROC)lazy_load("glRecti");
+	glad_glRecti(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) {
+	glad_glRectiv = (PFNGLRECTIVPROC)lazy_load("glRectiv");
+	glad_glRectiv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	glad_glRects = (PFNGLRECTSPROC)lazy_load("glRects");
+	glad_glRects(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+	glad_glRectsv = (PFNGLRECTSVPROC)lazy_load("glRectsv");
+	glad_glRectsv(v1, v2);
+}
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) {
+	glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)lazy_load("glTexCoord1d");
+	glad_glTexCoord1d(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) {
+	glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)lazy_load("glTexCoord1dv");
+	glad_glTexCoord1dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) {
+	glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)lazy_load("glTexCoord1f");
+	glad_glTexCoord1f(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) {
+	glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)lazy_load("glTexCoord1fv");
+	glad_glTexCoord1fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) {
+	glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)lazy_load("glTexCoord1i");
+	glad_glTexCoord1i(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) {
+	glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)lazy_load("glTexCoord1iv");
+	glad_glTexCoord1iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) {
+	glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)lazy_load("glTexCoord1s");
+	glad_glTexCoord1s(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) {
+	glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)lazy_load("glTexCoord1sv");
+	glad_glTexCoord1sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+	glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)lazy_load("glTexCoord2d");
+	glad_glTexCoord2d(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) {
+	glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)lazy_load("glTexCoord2dv");
+	glad_glTexCoord2dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+	glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)lazy_load("glTexCoord2f");
+	glad_glTexCoord2f(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) {
+	glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)lazy_load("glTexCoord2fv");
+	glad_glTexCoord2fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) {
+	glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)lazy_load("glTexCoord2i");
+	glad_glTexCoord2i(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) {
+	glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)lazy_load("glTexCoord2iv");
+	glad_glTexCoord2iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) {
+	glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)lazy_load("glTexCoord2s");
+	glad_glTexCoord2s(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) {
+	glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)lazy_load("glTexCoord2sv");
+	glad_glTexCoord2sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)lazy_load("glTexCoord3d");
+	glad_glTexCoord3d(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) {
+	glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)lazy_load("glTexCoord3dv");
+	glad_glTexCoord3dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)lazy_load("glTexCoord3f");
+	glad_glTexCoord3f(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) {
+	glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)lazy_load("glTexCoord3fv");
+	glad_glTexCoord3fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+	glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)lazy_load("glTexCoord3i");
+	glad_glTexCoord3i(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) {
+	glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)lazy_load("glTexCoord3iv");
+	glad_glTexCoord3iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)lazy_load("glTexCoord3s");
+	glad_glTexCoord3s(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) {
+	glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)lazy_load("glTexCoord3sv");
+	glad_glTexCoord3sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)lazy_load("glTexCoord4d");
+	glad_glTexCoord4d(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) {
+	glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)lazy_load("glTexCoord4dv");
+	glad_glTexCoord4dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)lazy_load("glTexCoord4f");
+	glad_glTexCoord4f(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) {
+	glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)lazy_load("glTexCoord4fv");
+	glad_glTexCoord4fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)lazy_load("glTexCoord4i");
+	glad_glTexCoord4i(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) {
+	glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)lazy_load("glTexCoord4iv");
+	glad_glTexCoord4iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)lazy_load("glTexCoord4s");
+	glad_glTexCoord4s(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) {
+	glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)lazy_load("glTexCoord4sv");
+	glad_glTexCoord4sv(v);
+}
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) {
+	glad_glVertex2d = (PFNGLVERTEX2DPROC)lazy_load("glVertex2d");
+	glad_glVertex2d(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) {
+	glad_glVertex2dv = (PFNGLVERTEX2DVPROC)lazy_load("glVertex2dv");
+	glad_glVertex2dv(v);
+}
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) {
+	glad_glVertex2f = (PFNGLVERTEX2FPROC)lazy_load("glVertex2f");
+	glad_glVertex2f(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) {
+	glad_glVertex2fv = (PFNGLVERTEX2FVPROC)lazy_load("glVertex2fv");
+	glad_glVertex2fv(v);
+}
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) {
+	glad_glVertex2i = (PFNGLVERTEX2IPROC)lazy_load("glVertex2i");
+	glad_glVertex2i(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) {
+	glad_glVertex2iv = (PFNGLVERTEX2IVPROC)lazy_load("glVertex2iv");
+	glad_glVertex2iv(v);
+}
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) {
+	glad_glVertex2s = (PFNGLVERTEX2SPROC)lazy_load("glVertex2s");
+	glad_glVertex2s(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) {
+	glad_glVertex2sv = (PFNGLVERTEX2SVPROC)lazy_load("glVertex2sv");
+	glad_glVertex2sv(v);
+}
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertex3d = (PFNGLVERTEX3DPROC)lazy_load("glVertex3d");
+	glad_glVertex3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) {
+	glad_glVertex3dv = (PFNGLVERTEX3DVPROC)lazy_load("glVertex3dv");
+	glad_glVertex3dv(v);
+}
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertex3f = (PFNGLVERTEX3FPROC)lazy_load("glVertex3f");
+	glad_glVertex3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) {
+	glad_glVertex3fv = (PFNGLVERTEX3FVPROC)lazy_load("glVertex3fv");
+	glad_glVertex3fv(v);
+}
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) {
+	glad_glVertex3i = (PFNGLVERTEX3IPROC)lazy_load("glVertex3i");
+	glad_glVertex3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) {
+	glad_glVertex3iv = (PFNGLVERTEX3IVPROC)lazy_load("glVertex3iv");
+	glad_glVertex3iv(v);
+}
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	glad_glVertex3s = (PFNGLVERTEX3SPROC)lazy_load("glVertex3s");
+	glad_glVertex3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) {
+	glad_glVertex3sv = (PFNGLVERTEX3SVPROC)lazy_load("glVertex3sv");
+	glad_glVertex3sv(v);
+}
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertex4d = (PFNGLVERTEX4DPROC)lazy_load("glVertex4d");
+	glad_glVertex4d(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) {
+	glad_glVertex4dv = (PFNGLVERTEX4DVPROC)lazy_load("glVertex4dv");
+	glad_glVertex4dv(v);
+}
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertex4f = (PFNGLVERTEX4FPROC)lazy_load("glVertex4f");
+	glad_glVertex4f(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) {
+	glad_glVertex4fv = (PFNGLVERTEX4FVPROC)lazy_load("glVertex4fv");
+	glad_glVertex4fv(v);
+}
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertex4i = (PFNGLVERTEX4IPROC)lazy_load("glVertex4i");
+	glad_glVertex4i(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) {
+	glad_glVertex4iv = (PFNGLVERTEX4IVPROC)lazy_load("glVertex4iv");
+	glad_glVertex4iv(v);
+}
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertex4s = (PFNGLVERTEX4SPROC)lazy_load("glVertex4s");
+	glad_glVertex4s(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) {
+	glad_glVertex4sv = (PFNGLVERTEX4SVPROC)lazy_load("glVertex4sv");
+	glad_glVertex4sv(v);
+}
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+	glad_glClipPlane = (PFNGLCLIPPLANEPROC)lazy_load("glClipPlane");
+	glad_glClipPlane(plane, equation);
+}
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) {
+	glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)lazy_load("glColorMaterial");
+	glad_glColorMaterial(face, mode);
+}
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) {
+	glad_glFogf = (PFNGLFOGFPROC)lazy_load("glFogf");
+	glad_glFogf(pname, param);
+}
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) {
+	glad_glFogfv = (PFNGLFOGFVPROC)lazy_load("glFogfv");
+	glad_glFogfv(pname, params);
+}
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) {
+	glad_glFogi = (PFNGLFOGIPROC)lazy_load("glFogi");
+	glad_glFogi(pname, param);
+}
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) {
+	glad_glFogiv = (PFNGLFOGIVPROC)lazy_load("glFogiv");
+	glad_glFogiv(pname, params);
+}
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	glad_glLightf = (PFNGLLIGHTFPROC)lazy_load("glLightf");
+	glad_glLightf(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_glLightfv = (PFNGLLIGHTFVPROC)lazy_load("glLightfv");
+	glad_glLightfv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+	glad_glLighti = (PFNGLLIGHTIPROC)lazy_load("glLighti");
+	glad_glLighti(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	glad_glLightiv = (PFNGLLIGHTIVPROC)lazy_load("glLightiv");
+	glad_glLightiv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) {
+	glad_glLightModelf = (PFNGLLIGHTMODELFPROC)lazy_load("glLightModelf");
+	glad_glLightModelf(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+	glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)lazy_load("glLightModelfv");
+	glad_glLightModelfv(pname, params);
+}
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) {
+	glad_glLightModeli = (PFNGLLIGHTMODELIPROC)lazy_load("glLightModeli");
+	glad_glLightModeli(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) {
+	glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)lazy_load("glLightModeliv");
+	glad_glLightModeliv(pname, params);
+}
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) {
+	glad_glLineStipple = (PFNGLLINESTIPPLEPROC)lazy_load("glLineStipple");
+	glad_glLineStipple(factor, pattern);
+}
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	glad_glMaterialf = (PFNGLMATERIALFPROC)lazy_load("glMaterialf");
+	glad_glMaterialf(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_glMaterialfv = (PFNGLMATERIALFVPROC)lazy_load("glMaterialfv");
+	glad_glMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+	glad_glMateriali = (PFNGLMATERIALIPROC)lazy_load("glMateriali");
+	glad_glMateriali(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	glad_glMaterialiv = (PFNGLMATERIALIVPROC)lazy_load("glMaterialiv");
+	glad_glMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) {
+	glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)lazy_load("glPolygonStipple");
+	glad_glPolygonStipple(mask);
+}
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) {
+	glad_glShadeModel = (PFNGLSHADEMODELPROC)lazy_load("glShadeModel");
+	glad_glShadeModel(mode);
+}
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexEnvf = (PFNGLTEXENVFPROC)lazy_load("glTexEnvf");
+	glad_glTexEnvf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexEnvfv = (PFNGLTEXENVFVPROC)lazy_load("glTexEnvfv");
+	glad_glTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	glad_glTexEnvi = (PFNGLTEXENVIPROC)lazy_load("glTexEnvi");
+	glad_glTexEnvi(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexEnviv = (PFNGLTEXENVIVPROC)lazy_load("glTexEnviv");
+	glad_glTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	glad_glTexGend = (PFNGLTEXGENDPROC)lazy_load("glTexGend");
+	glad_glTexGend(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_glTexGendv = (PFNGLTEXGENDVPROC)lazy_load("glTexGendv");
+	glad_glTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	glad_glTexGenf = (PFNGLTEXGENFPROC)lazy_load("glTexGenf");
+	glad_glTexGenf(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_glTexGenfv = (PFNGLTEXGENFVPROC)lazy_load("glTexGenfv");
+	glad_glTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	glad_glTexGeni = (PFNGLTEXGENIPROC)lazy_load("glTexGeni");
+	glad_glTexGeni(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	glad_glTexGeniv = (PFNGLTEXGENIVPROC)lazy_load("glTexGeniv");
+	glad_glTexGeniv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)lazy_load("glFeedbackBuffer");
+	glad_glFeedbackBuffer(size, type, buffer);
+}
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)lazy_load("glSelectBuffer");
+	glad_glSelectBuffer(size, buffer);
+}
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) {
+	glad_glRenderMode = (PFNGLRENDERMODEPROC)lazy_load("glRenderMode");
+	return glad_glRenderMode(mode);
+}
+static void APIENTRY glad_lazy_glInitNames(void) {
+	glad_glInitNames = (PFNGLINITNAMESPROC)lazy_load("glInitNames");
+	glad_glInitNames();
+}
+static void APIENTRY glad_lazy_glLoadName(GLuint name) {
+	glad_glLoadName = (PFNGLLOADNAMEPROC)lazy_load("glLoadName");
+	glad_glLoadName(name);
+}
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) {
+	glad_glPassThrough = (PFNGLPASSTHROUGHPROC)lazy_load("glPassThrough");
+	glad_glPassThrough(token);
+}
+static void APIENTRY glad_lazy_glPopName(void) {
+	glad_glPopName = (PFNGLPOPNAMEPROC)lazy_load("glPopName");
+	glad_glPopName();
+}
+static void APIENTRY glad_lazy_glPushName(GLuint name) {
+	glad_glPushName = (PFNGLPUSHNAMEPROC)lazy_load("glPushName");
+	glad_glPushName(name);
+}
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearAccum = (PFNGLCLEARACCUMPROC)lazy_load("glClearAccum");
+	glad_glClearAccum(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) {
+	glad_glClearIndex = (PFNGLCLEARINDEXPROC)lazy_load("glClearIndex");
+	glad_glClearIndex(c);
+}
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) {
+	glad_glIndexMask = (PFNGLINDEXMASKPROC)lazy_load("glIndexMask");
+	glad_glIndexMask(mask);
+}
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) {
+	glad_glAccum = (PFNGLACCUMPROC)lazy_load("glAccum");
+	glad_glAccum(op, value);
+}
+static void APIENTRY glad_lazy_glPopAttrib(void) {
+	glad_glPopAttrib = (PFNGLPOPATTRIBPROC)lazy_load("glPopAttrib");
+	glad_glPopAttrib();
+}
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) {
+	glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)lazy_load("glPushAttrib");
+	glad_glPushAttrib(mask);
+}
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_glMap1d = (PFNGLMAP1DPROC)lazy_load("glMap1d");
+	glad_glMap1d(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_glMap1f = (PFNGLMAP1FPROC)lazy_load("glMap1f");
+	glad_glMap1f(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_glMap2d = (PFNGLMAP2DPROC)lazy_load("glMap2d");
+	glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_glMap2f = (PFNGLMAP2FPROC)lazy_load("glMap2f");
+	glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)lazy_load("glMapGrid1d");
+	glad_glMapGrid1d(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)lazy_load("glMapGrid1f");
+	glad_glMapGrid1f(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)lazy_load("glMapGrid2d");
+	glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)lazy_load("glMapGrid2f");
+	glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) {
+	glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)lazy_load("glEvalCoord1d");
+	glad_glEvalCoord1d(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) {
+	glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)lazy_load("glEvalCoord1dv");
+	glad_glEvalCoord1dv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) {
+	glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)lazy_load("glEvalCoord1f");
+	glad_glEvalCoord1f(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) {
+	glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)lazy_load("glEvalCoord1fv");
+	glad_glEvalCoord1fv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+	glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)lazy_load("glEvalCoord2d");
+	glad_glEvalCoord2d(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) {
+	glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)lazy_load("glEvalCoord2dv");
+	glad_glEvalCoord2dv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+	glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)lazy_load("glEvalCoord2f");
+	glad_glEvalCoord2f(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) {
+	glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)lazy_load("glEvalCoord2fv");
+	glad_glEvalCoord2fv(u);
+}
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)lazy_load("glEvalMesh1");
+	glad_glEvalMesh1(mode, i1, i2);
+}
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) {
+	glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)lazy_load("glEvalPoint1");
+	glad_glEvalPoint1(i);
+}
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)lazy_load("glEvalMesh2");
+	glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) {
+	glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)lazy_load("glEvalPoint2");
+	glad_glEvalPoint2(i, j);
+}
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+	glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)lazy_load("glAlphaFunc");
+	glad_glAlphaFunc(func, ref);
+}
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	glad_glPixelZoom = (PFNGLPIXELZOOMPROC)lazy_load("glPixelZoom");
+	glad_glPixelZoom(xfactor, yfactor);
+}
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+	glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)lazy_load("glPixelTransferf");
+	glad_glPixelTransferf(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) {
+	glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)lazy_load("glPixelTransferi");
+	glad_glPixelTransferi(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)lazy_load("glPixelMapfv");
+	glad_glPixelMapfv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)lazy_load("glPixelMapuiv");
+	glad_glPixelMapuiv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)lazy_load("glPixelMapusv");
+	glad_glPixelMapusv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)lazy_load("glCopyPixels");
+	glad_glCopyPixels(x, y, width, height, type);
+}
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)lazy_load("glDrawPixels");
+	glad_glDrawPixels(width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)lazy_load("glGetClipPlane");
+	glad_glGetClipPlane(plane, equation);
+}
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)lazy_load("glGetLightfv");
+	glad_glGetLightfv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)lazy_load("glGetLightiv");
+	glad_glGetLightiv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	glad_glGetMapdv = (PFNGLGETMAPDVPROC)lazy_load("glGetMapdv");
+	glad_glGetMapdv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	glad_glGetMapfv = (PFNGLGETMAPFVPROC)lazy_load("glGetMapfv");
+	glad_glGetMapfv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	glad_glGetMapiv = (PFNGLGETMAPIVPROC)lazy_load("glGetMapiv");
+	glad_glGetMapiv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)lazy_load("glGetMaterialfv");
+	glad_glGetMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)lazy_load("glGetMaterialiv");
+	glad_glGetMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)lazy_load("glGetPixelMapfv");
+	glad_glGetPixelMapfv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)lazy_load("glGetPixelMapuiv");
+	glad_glGetPixelMapuiv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+	glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)lazy_load("glGetPixelMapusv");
+	glad_glGetPixelMapusv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) {
+	glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)lazy_load("glGetPolygonStipple");
+	glad_glGetPolygonStipple(mask);
+}
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)lazy_load("glGetTexEnvfv");
+	glad_glGetTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)lazy_load("glGetTexEnviv");
+	glad_glGetTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)lazy_load("glGetTexGendv");
+	glad_glGetTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)lazy_load("glGetTexGenfv");
+	glad_glGetTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)lazy_load("glGetTexGeniv");
+	glad_glGetTexGeniv(coord, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) {
+	glad_glIsList = (PFNGLISLISTPROC)lazy_load("glIsList");
+	return glad_glIsList(list);
+}
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glFrustum = (PFNGLFRUSTUMPROC)lazy_load("glFrustum");
+	glad_glFrustum(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glLoadIdentity(void) {
+	glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)lazy_load("glLoadIdentity");
+	glad_glLoadIdentity();
+}
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) {
+	glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)lazy_load("glLoadMatrixf");
+	glad_glLoadMatrixf(m);
+}
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) {
+	glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)lazy_load("glLoadMatrixd");
+	glad_glLoadMatrixd(m);
+}
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) {
+	glad_glMatrixMode = (PFNGLMATRIXMODEPROC)lazy_load("glMatrixMode");
+	glad_glMatrixMode(mode);
+}
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) {
+	glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)lazy_load("glMultMatrixf");
+	glad_glMultMatrixf(m);
+}
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) {
+	glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)lazy_load("glMultMatrixd");
+	glad_glMultMatrixd(m);
+}
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glOrtho = (PFNGLORTHOPROC)lazy_load("glOrtho");
+	glad_glOrtho(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glPopMatrix(void) {
+	glad_glPopMatrix = (PFNGLPOPMATRIXPROC)lazy_load("glPopMatrix");
+	glad_glPopMatrix();
+}
+static void APIENTRY glad_lazy_glPushMatrix(void) {
+	glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)lazy_load("glPushMatrix");
+	glad_glPushMatrix();
+}
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRotated = (PFNGLROTATEDPROC)lazy_load("glRotated");
+	glad_glRotated(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRotatef = (PFNGLROTATEFPROC)lazy_load("glRotatef");
+	glad_glRotatef(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glScaled = (PFNGLSCALEDPROC)lazy_load("glScaled");
+	glad_glScaled(x, y, z);
+}
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glScalef = (PFNGLSCALEFPROC)lazy_load("glScalef");
+	glad_glScalef(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glTranslated = (PFNGLTRANSLATEDPROC)lazy_load("glTranslated");
+	glad_glTranslated(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTranslatef = (PFNGLTRANSLATEFPROC)lazy_load("glTranslatef");
+	glad_glTranslatef(x, y, z);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)lazy_load("glDrawArrays");
+	glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)lazy_load("glDrawElements");
+	glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)lazy_load("glGetPointerv");
+	glad_glGetPointerv(pname, params);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)lazy_load("glPolygonOffset");
+	glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)lazy_load("glCopyTexImage1D");
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)lazy_load("glCopyTexImage2D");
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)lazy_load("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)lazy_load("glCopyTexSubImage2D");
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)lazy_load("glTexSubImage1D");
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)lazy_load("glTexSubImage2D");
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)lazy_load("glBindTexture");
+	glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)lazy_load("glDeleteTextures");
+	glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)lazy_load("glGenTextures");
+	glad_glGenTextures(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)lazy_load("glIsTexture");
+	return glad_glIsTexture(texture);
+}
+static void APIENTRY glad_lazy_glArrayElement(GLint i) {
+	glad_glArrayElement = (PFNGLARRAYELEMENTPROC)lazy_load("glArrayElement");
+	glad_glArrayElement(i);
+}
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glColorPointer = (PFNGLCOLORPOINTERPROC)lazy_load("glColorPointer");
+	glad_glColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) {
+	glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)lazy_load("glDisableClientState");
+	glad_glDisableClientState(array);
+}
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)lazy_load("glEdgeFlagPointer");
+	glad_glEdgeFlagPointer(stride, pointer);
+}
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) {
+	glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)lazy_load("glEnableClientState");
+	glad_glEnableClientState(array);
+}
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)lazy_load("glIndexPointer");
+	glad_glIndexPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)lazy_load("glInterleavedArrays");
+	glad_glInterleavedArrays(format, stride, pointer);
+}
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)lazy_load("glNormalPointer");
+	glad_glNormalPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)lazy_load("glTexCoordPointer");
+	glad_glTexCoordPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)lazy_load("glVertexPointer");
+	glad_glVertexPointer(size, type, stride, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)lazy_load("glAreTexturesResident");
+	return glad_glAreTexturesResident(n, textures, residences);
+}
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)lazy_load("glPrioritizeTextures");
+	glad_glPrioritizeTextures(n, textures, priorities);
+}
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) {
+	glad_glIndexub = (PFNGLINDEXUBPROC)lazy_load("glIndexub");
+	glad_glIndexub(c);
+}
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) {
+	glad_glIndexubv = (PFNGLINDEXUBVPROC)lazy_load("glIndexubv");
+	glad_glIndexubv(c);
+}
+static void APIENTRY glad_lazy_glPopClientAttrib(void) {
+	glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)lazy_load("glPopClientAttrib");
+	glad_glPopClientAttrib();
+}
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) {
+	glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)lazy_load("glPushClientAttrib");
+	glad_glPushClientAttrib(mask);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)lazy_load("glDrawRangeElements");
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)lazy_load("glTexImage3D");
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)lazy_load("glTexSubImage3D");
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)lazy_load("glCopyTexSubImage3D");
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)lazy_load("glActiveTexture");
+	glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)lazy_load("glSampleCoverage");
+	glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)lazy_load("glCompressedTexImage3D");
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)lazy_load("glCompressedTexImage2D");
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)lazy_load("glCompressedTexImage1D");
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)lazy_load("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)lazy_load("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)lazy_load("glCompressedTexSubImage1D");
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)lazy_load("glGetCompressedTexImage");
+	glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) {
+	glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)lazy_load("glClientActiveTexture");
+	glad_glClientActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)lazy_load("glMultiTexCoord1d");
+	glad_glMultiTexCoord1d(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)lazy_load("glMultiTexCoord1dv");
+	glad_glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)lazy_load("glMultiTexCoord1f");
+	glad_glMultiTexCoord1f(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)lazy_load("glMultiTexCoord1fv");
+	glad_glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+	glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)lazy_load("glMultiTexCoord1i");
+	glad_glMultiTexCoord1i(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)lazy_load("glMultiTexCoord1iv");
+	glad_glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+	glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)lazy_load("glMultiTexCoord1s");
+	glad_glMultiTexCoord1s(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)lazy_load("glMultiTexCoord1sv");
+	glad_glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)lazy_load("glMultiTexCoord2d");
+	glad_glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)lazy_load("glMultiTexCoord2dv");
+	glad_glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)lazy_load("glMultiTexCoord2f");
+	glad_glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)lazy_load("glMultiTexCoord2fv");
+	glad_glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)lazy_load("glMultiTexCoord2i");
+	glad_glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)lazy_load("glMultiTexCoord2iv");
+	glad_glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)lazy_load("glMultiTexCoord2s");
+	glad_glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)lazy_load("glMultiTexCoord2sv");
+	glad_glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)lazy_load("glMultiTexCoord3d");
+	glad_glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)lazy_load("glMultiTexCoord3dv");
+	glad_glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)lazy_load("glMultiTexCoord3f");
+	glad_glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)lazy_load("glMultiTexCoord3fv");
+	glad_glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)lazy_load("glMultiTexCoord3i");
+	glad_glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)lazy_load("glMultiTexCoord3iv");
+	glad_glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)lazy_load("glMultiTexCoord3s");
+	glad_glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)lazy_load("glMultiTexCoord3sv");
+	glad_glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)lazy_load("glMultiTexCoord4d");
+	glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)lazy_load("glMultiTexCoord4dv");
+	glad_glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)lazy_load("glMultiTexCoord4f");
+	glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)lazy_load("glMultiTexCoord4fv");
+	glad_glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)lazy_load("glMultiTexCoord4i");
+	glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)lazy_load("glMultiTexCoord4iv");
+	glad_glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)lazy_load("glMultiTexCoord4s");
+	glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)lazy_load("glMultiTexCoord4sv");
+	glad_glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+	glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)lazy_load("glLoadTransposeMatrixf");
+	glad_glLoadTransposeMatrixf(m);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+	glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)lazy_load("glLoadTransposeMatrixd");
+	glad_glLoadTransposeMatrixd(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) {
+	glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)lazy_load("glMultTransposeMatrixf");
+	glad_glMultTransposeMatrixf(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) {
+	glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)lazy_load("glMultTransposeMatrixd");
+	glad_glMultTransposeMatrixd(m);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)lazy_load("glBlendFuncSeparate");
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)lazy_load("glMultiDrawArrays");
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)lazy_load("glMultiDrawElements");
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)lazy_load("glPointParameterf");
+	glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)lazy_load("glPointParameterfv");
+	glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)lazy_load("glPointParameteri");
+	glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)lazy_load("glPointParameteriv");
+	glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) {
+	glad_glFogCoordf = (PFNGLFOGCOORDFPROC)lazy_load("glFogCoordf");
+	glad_glFogCoordf(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) {
+	glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)lazy_load("glFogCoordfv");
+	glad_glFogCoordfv(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) {
+	glad_glFogCoordd = (PFNGLFOGCOORDDPROC)lazy_load("glFogCoordd");
+	glad_glFogCoordd(coord);
+}
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) {
+	glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)lazy_load("glFogCoorddv");
+	glad_glFogCoorddv(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)lazy_load("glFogCoordPointer");
+	glad_glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)lazy_load("glSecondaryColor3b");
+	glad_glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) {
+	glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)lazy_load("glSecondaryColor3bv");
+	glad_glSecondaryColor3bv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)lazy_load("glSecondaryColor3d");
+	glad_glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) {
+	glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)lazy_load("glSecondaryColor3dv");
+	glad_glSecondaryColor3dv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)lazy_load("glSecondaryColor3f");
+	glad_glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) {
+	glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)lazy_load("glSecondaryColor3fv");
+	glad_glSecondaryColor3fv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)lazy_load("glSecondaryColor3i");
+	glad_glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) {
+	glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)lazy_load("glSecondaryColor3iv");
+	glad_glSecondaryColor3iv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)lazy_load("glSecondaryColor3s");
+	glad_glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) {
+	glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)lazy_load("glSecondaryColor3sv");
+	glad_glSecondaryColor3sv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)lazy_load("glSecondaryColor3ub");
+	glad_glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) {
+	glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)lazy_load("glSecondaryColor3ubv");
+	glad_glSecondaryColor3ubv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)lazy_load("glSecondaryColor3ui");
+	glad_glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) {
+	glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)lazy_load("glSecondaryColor3uiv");
+	glad_glSecondaryColor3uiv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)lazy_load("glSecondaryColor3us");
+	glad_glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) {
+	glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)lazy_load("glSecondaryColor3usv");
+	glad_glSecondaryColor3usv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)lazy_load("glSecondaryColorPointer");
+	glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+	glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)lazy_load("glWindowPos2d");
+	glad_glWindowPos2d(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) {
+	glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)lazy_load("glWindowPos2dv");
+	glad_glWindowPos2dv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+	glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)lazy_load("glWindowPos2f");
+	glad_glWindowPos2f(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) {
+	glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)lazy_load("glWindowPos2fv");
+	glad_glWindowPos2fv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) {
+	glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)lazy_load("glWindowPos2i");
+	glad_glWindowPos2i(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) {
+	glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)lazy_load("glWindowPos2iv");
+	glad_glWindowPos2iv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) {
+	glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)lazy_load("glWindowPos2s");
+	glad_glWindowPos2s(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) {
+	glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)lazy_load("glWindowPos2sv");
+	glad_glWindowPos2sv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)lazy_load("glWindowPos3d");
+	glad_glWindowPos3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) {
+	glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)lazy_load("glWindowPos3dv");
+	glad_glWindowPos3dv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)lazy_load("glWindowPos3f");
+	glad_glWindowPos3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) {
+	glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)lazy_load("glWindowPos3fv");
+	glad_glWindowPos3fv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)lazy_load("glWindowPos3i");
+	glad_glWindowPos3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) {
+	glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)lazy_load("glWindowPos3iv");
+	glad_glWindowPos3iv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)lazy_load("glWindowPos3s");
+	glad_glWindowPos3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) {
+	glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)lazy_load("glWindowPos3sv");
+	glad_glWindowPos3sv(v);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)lazy_load("glBlendColor");
+	glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)lazy_load("glBlendEquation");
+	glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)lazy_load("glGenQueries");
+	glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)lazy_load("glDeleteQueries");
+	glad_glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)lazy_load("glIsQuery");
+	return glad_glIsQuery(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)lazy_load("glBeginQuery");
+	glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)lazy_load("glEndQuery");
+	glad_glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)lazy_load("glGetQueryiv");
+	glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)lazy_load("glGetQueryObjectiv");
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)lazy_load("glGetQueryObjectuiv");
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)lazy_load("glBindBuffer");
+	glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)lazy_load("glDeleteBuffers");
+	glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)lazy_load("glGenBuffers");
+	glad_glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)lazy_load("glIsBuffer");
+	return glad_glIsBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)lazy_load("glBufferData");
+	glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)lazy_load("glBufferSubData");
+	glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)lazy_load("glGetBufferSubData");
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)lazy_load("glMapBuffer");
+	return glad_glMapBuffer(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)lazy_load("glUnmapBuffer");
+	return glad_glUnmapBuffer(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)lazy_load("glGetBufferParameteriv");
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)lazy_load("glGetBufferPointerv");
+	glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)lazy_load("glBlendEquationSeparate");
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)lazy_load("glDrawBuffers");
+	glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)lazy_load("glStencilOpSeparate");
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)lazy_load("glStencilFuncSeparate");
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)lazy_load("glStencilMaskSeparate");
+	glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)lazy_load("glAttachShader");
+	glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)lazy_load("glBindAttribLocation");
+	glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)lazy_load("glCompileShader");
+	glad_glCompileShader(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)lazy_load("glCreateProgram");
+	return glad_glCreateProgram();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)lazy_load("glCreateShader");
+	return glad_glCreateShader(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)lazy_load("glDeleteProgram");
+	glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)lazy_load("glDeleteShader");
+	glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)lazy_load("glDetachShader");
+	glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)lazy_load("glDisableVertexAttribArray");
+	glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)lazy_load("glEnableVertexAttribArray");
+	glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)lazy_load("glGetActiveAttrib");
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)lazy_load("glGetActiveUniform");
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)lazy_load("glGetAttachedShaders");
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)lazy_load("glGetAttribLocation");
+	return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)lazy_load("glGetProgramiv");
+	glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)lazy_load("glGetProgramInfoLog");
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)lazy_load("glGetShaderiv");
+	glad_glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)lazy_load("glGetShaderInfoLog");
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)lazy_load("glGetShaderSource");
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)lazy_load("glGetUniformLocation");
+	return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)lazy_load("glGetUniformfv");
+	glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)lazy_load("glGetUniformiv");
+	glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)lazy_load("glGetVertexAttribdv");
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)lazy_load("glGetVertexAttribfv");
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)lazy_load("glGetVertexAttribiv");
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)lazy_load("glGetVertexAttribPointerv");
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)lazy_load("glIsProgram");
+	return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)lazy_load("glIsShader");
+	return glad_glIsShader(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)lazy_load("glLinkProgram");
+	glad_glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)lazy_load("glShaderSource");
+	glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)lazy_load("glUseProgram");
+	glad_glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)lazy_load("glUniform1f");
+	glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)lazy_load("glUniform2f");
+	glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)lazy_load("glUniform3f");
+	glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)lazy_load("glUniform4f");
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)lazy_load("glUniform1i");
+	glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)lazy_load("glUniform2i");
+	glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)lazy_load("glUniform3i");
+	glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)lazy_load("glUniform4i");
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)lazy_load("glUniform1fv");
+	glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)lazy_load("glUniform2fv");
+	glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)lazy_load("glUniform3fv");
+	glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)lazy_load("glUniform4fv");
+	glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)lazy_load("glUniform1iv");
+	glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)lazy_load("glUniform2iv");
+	glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)lazy_load("glUniform3iv");
+	glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)lazy_load("glUniform4iv");
+	glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)lazy_load("glUniformMatrix2fv");
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)lazy_load("glUniformMatrix3fv");
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)lazy_load("glUniformMatrix4fv");
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)lazy_load("glValidateProgram");
+	glad_glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)lazy_load("glVertexAttrib1d");
+	glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)lazy_load("glVertexAttrib1dv");
+	glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)lazy_load("glVertexAttrib1f");
+	glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)lazy_load("glVertexAttrib1fv");
+	glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)lazy_load("glVertexAttrib1s");
+	glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)lazy_load("glVertexAttrib1sv");
+	glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)lazy_load("glVertexAttrib2d");
+	glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)lazy_load("glVertexAttrib2dv");
+	glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)lazy_load("glVertexAttrib2f");
+	glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)lazy_load("glVertexAttrib2fv");
+	glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)lazy_load("glVertexAttrib2s");
+	glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)lazy_load("glVertexAttrib2sv");
+	glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)lazy_load("glVertexAttrib3d");
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)lazy_load("glVertexAttrib3dv");
+	glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)lazy_load("glVertexAttrib3f");
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)lazy_load("glVertexAttrib3fv");
+	glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)lazy_load("glVertexAttrib3s");
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)lazy_load("glVertexAttrib3sv");
+	glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)lazy_load("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)lazy_load("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)lazy_load("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)lazy_load("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)lazy_load("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)lazy_load("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)lazy_load("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)lazy_load("glVertexAttrib4bv");
+	glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)lazy_load("glVertexAttrib4d");
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)lazy_load("glVertexAttrib4dv");
+	glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)lazy_load("glVertexAttrib4f");
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)lazy_load("glVertexAttrib4fv");
+	glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)lazy_load("glVertexAttrib4iv");
+	glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)lazy_load("glVertexAttrib4s");
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)lazy_load("glVertexAttrib4sv");
+	glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)lazy_load("glVertexAttrib4ubv");
+	glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)lazy_load("glVertexAttrib4uiv");
+	glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)lazy_load("glVertexAttrib4usv");
+	glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)lazy_load("glVertexAttribPointer");
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)lazy_load("glUniformMatrix2x3fv");
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)lazy_load("glUniformMatrix3x2fv");
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)lazy_load("glUniformMatrix2x4fv");
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)lazy_load("glUniformMatrix4x2fv");
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)lazy_load("glUniformMatrix3x4fv");
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)lazy_load("glUniformMatrix4x3fv");
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)lazy_load("glColorMaski");
+	glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)lazy_load("glGetBooleani_v");
+	glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)lazy_load("glGetIntegeri_v");
+	glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)lazy_load("glEnablei");
+	glad_glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)lazy_load("glDisablei");
+	glad_glDisablei(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)lazy_load("glIsEnabledi");
+	return glad_glIsEnabledi(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)lazy_load("glBeginTransformFeedback");
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)lazy_load("glEndTransformFeedback");
+	glad_glEndTransformFeedback();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)lazy_load("glBindBufferRange");
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)lazy_load("glBindBufferBase");
+	glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)lazy_load("glTransformFeedbackVaryings");
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)lazy_load("glGetTransformFeedbackVarying");
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)lazy_load("glClampColor");
+	glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)lazy_load("glBeginConditionalRender");
+	glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)lazy_load("glEndConditionalRender");
+	glad_glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)lazy_load("glVertexAttribIPointer");
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)lazy_load("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)lazy_load("glGetVertexAttribIuiv");
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)lazy_load("glVertexAttribI1i");
+	glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)lazy_load("glVertexAttribI2i");
+	glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)lazy_load("glVertexAttribI3i");
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)lazy_load("glVertexAttribI4i");
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)lazy_load("glVertexAttribI1ui");
+	glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)lazy_load("glVertexAttribI2ui");
+	glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)lazy_load("glVertexAttribI3ui");
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)lazy_load("glVertexAttribI4ui");
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)lazy_load("glVertexAttribI1iv");
+	glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)lazy_load("glVertexAttribI2iv");
+	glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)lazy_load("glVertexAttribI3iv");
+	glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)lazy_load("glVertexAttribI4iv");
+	glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)lazy_load("glVertexAttribI1uiv");
+	glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)lazy_load("glVertexAttribI2uiv");
+	glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)lazy_load("glVertexAttribI3uiv");
+	glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)lazy_load("glVertexAttribI4uiv");
+	glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)lazy_load("glVertexAttribI4bv");
+	glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)lazy_load("glVertexAttribI4sv");
+	glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)lazy_load("glVertexAttribI4ubv");
+	glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)lazy_load("glVertexAttribI4usv");
+	glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)lazy_load("glGetUniformuiv");
+	glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)lazy_load("glBindFragDataLocation");
+	glad_glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)lazy_load("glGetFragDataLocation");
+	return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)lazy_load("glUniform1ui");
+	glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)lazy_load("glUniform2ui");
+	glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)lazy_load("glUniform3ui");
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)lazy_load("glUniform4ui");
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)lazy_load("glUniform1uiv");
+	glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)lazy_load("glUniform2uiv");
+	glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)lazy_load("glUniform3uiv");
+	glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)lazy_load("glUniform4uiv");
+	glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)lazy_load("glTexParameterIiv");
+	glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)lazy_load("glTexParameterIuiv");
+	glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)lazy_load("glGetTexParameterIiv");
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)lazy_load("glGetTexParameterIuiv");
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)lazy_load("glClearBufferiv");
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)lazy_load("glClearBufferuiv");
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)lazy_load("glClearBufferfv");
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)lazy_load("glClearBufferfi");
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)lazy_load("glGetStringi");
+	return glad_glGetStringi(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)lazy_load("glIsRenderbuffer");
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)lazy_load("glBindRenderbuffer");
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)lazy_load("glDeleteRenderbuffers");
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)lazy_load("glGenRenderbuffers");
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)lazy_load("glRenderbufferStorage");
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)lazy_load("glGetRenderbufferParameteriv");
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)lazy_load("glIsFramebuffer");
+	return glad_glIsFramebuffer(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)lazy_load("glBindFramebuffer");
+	glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)lazy_load("glDeleteFramebuffers");
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)lazy_load("glGenFramebuffers");
+	glad_glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)lazy_load("glCheckFramebufferStatus");
+	return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)lazy_load("glFramebufferTexture1D");
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)lazy_load("glFramebufferTexture2D");
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)lazy_load("glFramebufferTexture3D");
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)lazy_load("glFramebufferRenderbuffer");
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)lazy_load("glGetFramebufferAttachmentParameteriv");
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)lazy_load("glGenerateMipmap");
+	glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)lazy_load("glBlitFramebuffer");
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)lazy_load("glRenderbufferStorageMultisample");
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)lazy_load("glFramebufferTextureLayer");
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)lazy_load("glMapBufferRange");
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)lazy_load("glFlushMappedBufferRange");
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)lazy_load("glBindVertexArray");
+	glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)lazy_load("glDeleteVertexArrays");
+	glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)lazy_load("glGenVertexArrays");
+	glad_glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)lazy_load("glIsVertexArray");
+	return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)lazy_load("glDrawArraysInstanced");
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)lazy_load("glDrawElementsInstanced");
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)lazy_load("glTexBuffer");
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)lazy_load("glPrimitiveRestartIndex");
+	glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)lazy_load("glCopyBufferSubData");
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)lazy_load("glGetUniformIndices");
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)lazy_load("glGetActiveUniformsiv");
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)lazy_load("glGetActiveUniformName");
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)lazy_load("glGetUniformBlockIndex");
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)lazy_load("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)lazy_load("glGetActiveUniformBlockName");
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)lazy_load("glUniformBlockBinding");
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)lazy_load("glDrawElementsBaseVertex");
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)lazy_load("glDrawRangeElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)lazy_load("glDrawElementsInstancedBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)lazy_load("glMultiDrawElementsBaseVertex");
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)lazy_load("glProvokingVertex");
+	glad_glProvokingVertex(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)lazy_load("glFenceSync");
+	return glad_glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)lazy_load("glIsSync");
+	return glad_glIsSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)lazy_load("glDeleteSync");
+	glad_glDeleteSync(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)lazy_load("glClientWaitSync");
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)lazy_load("glWaitSync");
+	glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)lazy_load("glGetInteger64v");
+	glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)lazy_load("glGetSynciv");
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)lazy_load("glGetInteger64i_v");
+	glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)lazy_load("glGetBufferParameteri64v");
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)lazy_load("glFramebufferTexture");
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)lazy_load("glTexImage2DMultisample");
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)lazy_load("glTexImage3DMultisample");
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)lazy_load("glGetMultisamplefv");
+	glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)lazy_load("glSampleMaski");
+	glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)lazy_load("glBindFragDataLocationIndexed");
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)lazy_load("glGetFragDataIndex");
+	return glad_glGetFragDataIndex(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)lazy_load("glGenSamplers");
+	glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)lazy_load("glDeleteSamplers");
+	glad_glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)lazy_load("glIsSampler");
+	return glad_glIsSampler(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)lazy_load("glBindSampler");
+	glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)lazy_load("glSamplerParameteri");
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)lazy_load("glSamplerParameteriv");
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)lazy_load("glSamplerParameterf");
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)lazy_load("glSamplerParameterfv");
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)lazy_load("glSamplerParameterIiv");
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)lazy_load("glSamplerParameterIuiv");
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)lazy_load("glGetSamplerParameteriv");
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)lazy_load("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)lazy_load("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)lazy_load("glGetSamplerParameterIuiv");
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)lazy_load("glQueryCounter");
+	glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)lazy_load("glGetQueryObjecti64v");
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)lazy_load("glGetQueryObjectui64v");
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)lazy_load("glVertexAttribDivisor");
+	glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)lazy_load("glVertexAttribP1ui");
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)lazy_load("glVertexAttribP1uiv");
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)lazy_load("glVertexAttribP2ui");
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)lazy_load("glVertexAttribP2uiv");
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)lazy_load("glVertexAttribP3ui");
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)lazy_load("glVertexAttribP3uiv");
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)lazy_load("glVertexAttribP4ui");
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)lazy_load("glVertexAttribP4uiv");
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)lazy_load("glVertexP2ui");
+	glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)lazy_load("glVertexP2uiv");
+	glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)lazy_load("glVertexP3ui");
+	glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)lazy_load("glVertexP3uiv");
+	glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)lazy_load("glVertexP4ui");
+	glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)lazy_load("glVertexP4uiv");
+	glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)lazy_load("glTexCoordP1ui");
+	glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)lazy_load("glTexCoordP1uiv");
+	glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)lazy_load("glTexCoordP2ui");
+	glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)lazy_load("glTexCoordP2uiv");
+	glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)lazy_load("glTexCoordP3ui");
+	glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)lazy_load("glTexCoordP3uiv");
+	glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)lazy_load("glTexCoordP4ui");
+	glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)lazy_load("glTexCoordP4uiv");
+	glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)lazy_load("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)lazy_load("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)lazy_load("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)lazy_load("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)lazy_load("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)lazy_load("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)lazy_load("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)lazy_load("glMultiTexCoordP4uiv");
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)lazy_load("glNormalP3ui");
+	glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)lazy_load("glNormalP3uiv");
+	glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)lazy_load("glColorP3ui");
+	glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)lazy_load("glColorP3uiv");
+	glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)lazy_load("glColorP4ui");
+	glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)lazy_load("glColorP4uiv");
+	glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)lazy_load("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)lazy_load("glSecondaryColorP3uiv");
+	glad_glSecondaryColorP3uiv(type, color);
+}
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+	glad_glNewList = glad_lazy_glNewList;
+	glad_glEndList = glad_lazy_glEndList;
+	glad_glCallList = glad_lazy_glCallList;
+	glad_glCallLists = glad_lazy_glCallLists;
+	glad_glDeleteLists = glad_lazy_glDeleteLists;
+	glad_glGenLists = glad_lazy_glGenLists;
+	glad_glListBase = glad_lazy_glListBase;
+	glad_glBegin = glad_lazy_glBegin;
+	glad_glBitmap = glad_lazy_glBitmap;
+	glad_glColor3b = glad_lazy_glColor3b;
+	glad_glColor3bv = glad_lazy_glColor3bv;
+	glad_glColor3d = glad_lazy_glColor3d;
+	glad_glColor3dv = glad_lazy_glColor3dv;
+	glad_glColor3f = glad_lazy_glColor3f;
+	glad_glColor3fv = glad_lazy_glColor3fv;
+	glad_glColor3i = glad_lazy_glColor3i;
+	glad_glColor3iv = glad_lazy_glColor3iv;
+	glad_glColor3s = glad_lazy_glColor3s;
+	glad_glColor3sv = glad_lazy_glColor3sv;
+	glad_glColor3ub = glad_lazy_glColor3ub;
+	glad_glColor3ubv = glad_lazy_glColor3ubv;
+	glad_glColor3ui = glad_lazy_glColor3ui;
+	glad_glColor3uiv = glad_lazy_glColor3uiv;
+	glad_glColor3us = glad_lazy_glColor3us;
+	glad_glColor3usv = glad_lazy_glColor3usv;
+	glad_glColor4b = glad_lazy_glColor4b;
+	glad_glColor4bv = glad_lazy_glColor4bv;
+	glad_glColor4d = glad_lazy_glColor4d;
+	glad_glColor4dv = glad_lazy_glColor4dv;
+	glad_glColor4f = glad_lazy_glColor4f;
+	glad_glColor4fv = glad_lazy_glColor4fv;
+	glad_glColor4i = glad_lazy_glColor4i;
+	glad_glColor4iv = glad_lazy_glColor4iv;
+	glad_glColor4s = glad_lazy_glColor4s;
+	glad_glColor4sv = glad_lazy_glColor4sv;
+	glad_glColor4ub = glad_lazy_glColor4ub;
+	glad_glColor4ubv = glad_lazy_glColor4ubv;
+	glad_glColor4ui = glad_lazy_glColor4ui;
+	glad_glColor4uiv = glad_lazy_glColor4uiv;
+	glad_glColor4us = glad_lazy_glColor4us;
+	glad_glColor4usv = glad_lazy_glColor4usv;
+	glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+	glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+	glad_glEnd = glad_lazy_glEnd;
+	glad_glIndexd = glad_lazy_glIndexd;
+	glad_glIndexdv = glad_lazy_glIndexdv;
+	glad_glIndexf = glad_lazy_glIndexf;
+	glad_glIndexfv = glad_lazy_glIndexfv;
+	glad_glIndexi = glad_lazy_glIndexi;
+	glad_glIndexiv = glad_lazy_glIndexiv;
+	glad_glIndexs = glad_lazy_glIndexs;
+	glad_glIndexsv = glad_lazy_glIndexsv;
+	glad_glNormal3b = glad_lazy_glNormal3b;
+	glad_glNormal3bv = glad_lazy_glNormal3bv;
+	glad_glNormal3d = glad_lazy_glNormal3d;
+	glad_glNormal3dv = glad_lazy_glNormal3dv;
+	glad_glNormal3f = glad_lazy_glNormal3f;
+	glad_glNormal3fv = glad_lazy_glNormal3fv;
+	glad_glNormal3i = glad_lazy_glNormal3i;
+	glad_glNormal3iv = glad_lazy_glNormal3iv;
+	glad_glNormal3s = glad_lazy_glNormal3s;
+	glad_glNormal3sv = glad_lazy_glNormal3sv;
+	glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+	glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+	glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+	glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+	glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+	glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+	glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+	glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+	glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+	glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+	glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+	glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+	glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+	glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+	glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+	glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+	glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+	glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+	glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+	glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+	glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+	glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+	glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+	glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+	glad_glRectd = glad_lazy_glRectd;
+	glad_glRectdv = glad_lazy_glRectdv;
+	glad_glRectf = glad_lazy_glRectf;
+	glad_glRectfv = glad_lazy_glRectfv;
+	glad_glRecti = glad_lazy_glRecti;
+	glad_glRectiv = glad_lazy_glRectiv;
+	glad_glRects = glad_lazy_glRects;
+	glad_glRectsv = glad_lazy_glRectsv;
+	glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+	glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+	glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+	glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+	glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+	glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+	glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+	glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+	glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+	glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+	glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+	glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+	glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+	glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+	glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+	glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+	glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+	glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+	glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+	glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+	glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+	glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+	glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+	glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+	glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+	glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+	glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+	glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+	glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+	glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+	glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+	glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+	glad_glVertex2d = glad_lazy_glVertex2d;
+	glad_glVertex2dv = glad_lazy_glVertex2dv;
+	glad_glVertex2f = glad_lazy_glVertex2f;
+	glad_glVertex2fv = glad_lazy_glVertex2fv;
+	glad_glVertex2i = glad_lazy_glVertex2i;
+	glad_glVertex2iv = glad_lazy_glVertex2iv;
+	glad_glVertex2s = glad_lazy_glVertex2s;
+	glad_glVertex2sv = glad_lazy_glVertex2sv;
+	glad_glVertex3d = glad_lazy_glVertex3d;
+	glad_glVertex3dv = glad_lazy_glVertex3dv;
+	glad_glVertex3f = glad_lazy_glVertex3f;
+	glad_glVertex3fv = glad_lazy_glVertex3fv;
+	glad_glVertex3i = glad_lazy_glVertex3i;
+	glad_glVertex3iv = glad_lazy_glVertex3iv;
+	glad_glVertex3s = glad_lazy_glVertex3s;
+	glad_glVertex3sv = glad_lazy_glVertex3sv;
+	glad_glVertex4d = glad_lazy_glVertex4d;
+	glad_glVertex4dv = glad_lazy_glVertex4dv;
+	glad_glVertex4f = glad_lazy_glVertex4f;
+	glad_glVertex4fv = glad_lazy_glVertex4fv;
+	glad_glVertex4i = glad_lazy_glVertex4i;
+	glad_glVertex4iv = glad_lazy_glVertex4iv;
+	glad_glVertex4s = glad_lazy_glVertex4s;
+	glad_glVertex4sv = glad_lazy_glVertex4sv;
+	glad_glClipPlane = glad_lazy_glClipPlane;
+	glad_glColorMaterial = glad_lazy_glColorMaterial;
+	glad_glFogf = glad_lazy_glFogf;
+	glad_glFogfv = glad_lazy_glFogfv;
+	glad_glFogi = glad_lazy_glFogi;
+	glad_glFogiv = glad_lazy_glFogiv;
+	glad_glLightf = glad_lazy_glLightf;
+	glad_glLightfv = glad_lazy_glLightfv;
+	glad_glLighti = glad_lazy_glLighti;
+	glad_glLightiv = glad_lazy_glLightiv;
+	glad_glLightModelf = glad_lazy_glLightModelf;
+	glad_glLightModelfv = glad_lazy_glLightModelfv;
+	glad_glLightModeli = glad_lazy_glLightModeli;
+	glad_glLightModeliv = glad_lazy_glLightModeliv;
+	glad_glLineStipple = glad_lazy_glLineStipple;
+	glad_glMaterialf = glad_lazy_glMaterialf;
+	glad_glMaterialfv = glad_lazy_glMaterialfv;
+	glad_glMateriali = glad_lazy_glMateriali;
+	glad_glMaterialiv = glad_lazy_glMaterialiv;
+	glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+	glad_glShadeModel = glad_lazy_glShadeModel;
+	glad_glTexEnvf = glad_lazy_glTexEnvf;
+	glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+	glad_glTexEnvi = glad_lazy_glTexEnvi;
+	glad_glTexEnviv = glad_lazy_glTexEnviv;
+	glad_glTexGend = glad_lazy_glTexGend;
+	glad_glTexGendv = glad_lazy_glTexGendv;
+	glad_glTexGenf = glad_lazy_glTexGenf;
+	glad_glTexGenfv = glad_lazy_glTexGenfv;
+	glad_glTexGeni = glad_lazy_glTexGeni;
+	glad_glTexGeniv = glad_lazy_glTexGeniv;
+	glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+	glad_glRenderMode = glad_lazy_glRenderMode;
+	glad_glInitNames = glad_lazy_glInitNames;
+	glad_glLoadName = glad_lazy_glLoadName;
+	glad_glPassThrough = glad_lazy_glPassThrough;
+	glad_glPopName = glad_lazy_glPopName;
+	glad_glPushName = glad_lazy_glPushName;
+	glad_glClearAccum = glad_lazy_glClearAccum;
+	glad_glClearIndex = glad_lazy_glClearIndex;
+	glad_glIndexMask = glad_lazy_glIndexMask;
+	glad_glAccum = glad_lazy_glAccum;
+	glad_glPopAttrib = glad_lazy_glPopAttrib;
+	glad_glPushAttrib = glad_lazy_glPushAttrib;
+	glad_glMap1d = glad_lazy_glMap1d;
+	glad_glMap1f = glad_lazy_glMap1f;
+	glad_glMap2d = glad_lazy_glMap2d;
+	glad_glMap2f = glad_lazy_glMap2f;
+	glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+	glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+	glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+	glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+	glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+	glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+	glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+	glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+	glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+	glad_glPixelZoom = glad_lazy_glPixelZoom;
+	glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+	glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+	glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+	glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+	glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+	glad_glCopyPixels = glad_lazy_glCopyPixels;
+	glad_glDrawPixels = glad_lazy_glDrawPixels;
+	glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+	glad_glGetLightfv = glad_lazy_glGetLightfv;
+	glad_glGetLightiv = glad_lazy_glGetLightiv;
+	glad_glGetMapdv = glad_lazy_glGetMapdv;
+	glad_glGetMapfv = glad_lazy_glGetMapfv;
+	glad_glGetMapiv = glad_lazy_glGetMapiv;
+	glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+	glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+	glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+	glad_glIsList = glad_lazy_glIsList;
+	glad_glFrustum = glad_lazy_glFrustum;
+	glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+	glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+	glad_glMatrixMode = glad_lazy_glMatrixMode;
+	glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+	glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+	glad_glOrtho = glad_lazy_glOrtho;
+	glad_glPopMatrix = glad_lazy_glPopMatrix;
+	glad_glPushMatrix = glad_lazy_glPushMatrix;
+	glad_glRotated = glad_lazy_glRotated;
+	glad_glRotatef = glad_lazy_glRotatef;
+	glad_glScaled = glad_lazy_glScaled;
+	glad_glScalef = glad_lazy_glScalef;
+	glad_glTranslated = glad_lazy_glTranslated;
+	glad_glTranslatef = glad_lazy_glTranslatef;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+	glad_glArrayElement = glad_lazy_glArrayElement;
+	glad_glColorPointer = glad_lazy_glColorPointer;
+	glad_glDisableClientState = glad_lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = glad_lazy_glEnableClientState;
+	glad_glIndexPointer = glad_lazy_glIndexPointer;
+	glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+	glad_glNormalPointer = glad_lazy_glNormalPointer;
+	glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+	glad_glVertexPointer = glad_lazy_glVertexPointer;
+	glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+	glad_glIndexub = glad_lazy_glIndexub;
+	glad_glIndexubv = glad_lazy_glIndexubv;
+	glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+	glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glFogCoordf = glad_lazy_glFogCoordf;
+	glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+	glad_glFogCoordd = glad_lazy_glFogCoordd;
+	glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+	glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+	glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+	glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+	glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+	glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+	glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+	glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+	glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+	glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+	glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+	glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+	glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+	glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+	glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+	glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+	glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void load_GL_ARB_base_instance(GLADloadproc load) {
+	if(!GLAD_GL_ARB_base_instance) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_direct_state_access(GLADloadproc load) {
+	if(!GLAD_GL_ARB_direct_state_access) return;
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+}
+static void load_GL_ARB_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_ARB_texture_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_texture_storage) return;
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+}
+static int find_extensionsGL(void) {
+	if (!get_exts()) return 0;
+	GLAD_GL_ARB_base_instance = has_ext("GL_ARB_base_instance");
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
+	GLAD_GL_ARB_direct_state_access = has_ext("GL_ARB_direct_state_access");
+	GLAD_GL_ARB_draw_indirect = has_ext("GL_ARB_draw_indirect");
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_ARB_multi_draw_indirect = has_ext("GL_ARB_multi_draw_indirect");
+	GLAD_GL_ARB_shader_draw_parameters = has_ext("GL_ARB_shader_draw_parameters");
+	GLAD_GL_ARB_texture_storage = has_ext("GL_ARB_texture_storage");
+	return 1;
+}
+
+static void find_coreGL(void) {
+
+    /* Thank you @elmindreda
+     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
+     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
+     */
+    int i, major, minor;
+
+    const char* version;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+/* PR #18 */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+    max_loaded_major = major; max_loaded_minor = minor;
+	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
+		max_loaded_major = 3;
+		max_loaded_minor = 3;
+	}
+}
+
+static int load_gl(GLADloadproc load, int lazy) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	if (lazy) {
+		lazy_load = load;
+		lazy_GL_VERSION_1_0();
+		lazy_GL_VERSION_1_1();
+		lazy_GL_VERSION_1_2();
+		lazy_GL_VERSION_1_3();
+		lazy_GL_VERSION_1_4();
+		lazy_GL_VERSION_1_5();
+		lazy_GL_VERSION_2_0();
+		lazy_GL_VERSION_2_1();
+		lazy_GL_VERSION_3_0();
+		lazy_GL_VERSION_3_1();
+		lazy_GL_VERSION_3_2();
+		lazy_GL_VERSION_3_3();
+	} else {
+		load_GL_VERSION_1_0(load);
+		load_GL_VERSION_1_1(load);
+		load_GL_VERSION_1_2(load);
+		load_GL_VERSION_1_3(load);
+		load_GL_VERSION_1_4(load);
+		load_GL_VERSION_1_5(load);
+		load_GL_VERSION_2_0(load);
+		load_GL_VERSION_2_1(load);
+		load_GL_VERSION_3_0(load);
+		load_GL_VERSION_3_1(load);
+		load_GL_VERSION_3_2(load);
+		load_GL_VERSION_3_3(load);
+	}
+	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_base_instance(load);
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_direct_state_access(load);
+	load_GL_ARB_draw_indirect(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_ARB_multi_draw_indirect(load);
+	load_GL_ARB_texture_storage(load);
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+int gladLoadGLLoader(GLADloadproc load) {
+	return load_gl(load, 0);
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	return load_gl(load, 1);
 }
-
@@ -0,0 +1,260 @@
+#include "Core/Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+//Upper edges of the frame time histogram in milliseconds, the last bucket takes everything above the final edge.
+//The edges sit on the usual refresh intervals so the buckets read as "made 60 Hz", "made 30 Hz" and so on.
+static const double histogramEdges[] = { 1.0, 2.0, 4.0, 6.94, 8.33, 11.11, 16.67, 33.33, 50.0, 100.0 };
+static const size_t histogramBuckets = sizeof(histogramEdges) / sizeof(histogramEdges[0]) + 1;
+
+//Times closer than this to the baseline are never regressions, timer and scheduling noise is about this big
+static const double noiseFloorMs = 0.05;
+
+//The metrics in report order, the first three are times in milliseconds and the rest are counts
+static const char* metricNames[] = { "frameMs", "cpuMs", "gpuMs", "drawCalls", "stateCalls" };
+static const size_t metricCount = sizeof(metricNames) / sizeof(metricNames[0]);
+static const char* percentileNames[] = { "mean", "p50", "p95", "p99", "max" };
+static const size_t percentileCount = sizeof(percentileNames) / sizeof(percentileNames[0]);
+
+static double metricValue(const BenchmarkFrame& frame, size_t metric)
+{
+    switch (metric)
+    {
+    case 0: return frame.frameMs;
+    case 1: return frame.cpuMs;
+    case 2: return frame.gpuMs;
+    case 3: return frame.drawCalls;
+    default: return frame.stateCalls;
+    }
+}
+
+//This fills in mean, p50, p95, p99 and max of the values, sorting them in place
+static void summarize(std::vector<double>& values, double summary[percentileCount])
+{
+    std::fill(summary, summary + percentileCount, 0.0);
+    if (values.empty())
+    {
+        return;
+    }
+    std::sort(values.begin(), values.end());
+    double total = 0.0;
+    for (double value : values)
+    {
+        total += value;
+    }
+    auto rank = [&values](double percentile)
+    {
+        size_t index = (size_t)std::ceil(percentile / 100.0 * values.size());
+        return values[std::min(std::max(index, (size_t)1), values.size()) - 1];
+    };
+    summary[0] = total / values.size();
+    summary[1] = rank(50.0);
+    summary[2] = rank(95.0);
+    summary[3] = rank(99.0);
+    summary[4] = values.back();
+}
+
+//This escapes a string for a JSON string literal
+static std::string escape(const std::string& text)
+{
+    std::string escaped;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        if ((unsigned char)c >= 0x20)
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+Benchmark::Benchmark(unsigned int warmup, unsigned int measured)
+    : warmupFrames(warmup), frames(measured)
+{
+    samples.reserve(frames);
+}
+
+void Benchmark::addFrame(const BenchmarkFrame& frame)
+{
+    if (skipped < warmupFrames)
+    {
+        skipped++;
+        return;
+    }
+    if (!isDone())
+    {
+        samples.push_back(frame);
+    }
+}
+
+bool Benchmark::writeReport(const std::string& path, const BenchmarkInfo& info) const
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        std::cout << "ERROR::BENCHMARK::OPEN_FAILED " << path << std::endl;
+        return false;
+    }
+    fprintf(file, "{\n  \"scene\": \"%s\",\n  \"objects\": %u,\n  \"width\": %d,\n  \"height\": %d,\n  \"headless\": %s,\n  \"gl\": \"%s\",\n",
+        escape(info.scene).c_str(), info.objects, info.width, info.height, info.headless ? "true" : "false", escape(info.gl).c_str());
+    fprintf(file, "  \"warmupFrames\": %u,\n  \"frames\": %u,\n  \"metrics\": {\n", warmupFrames, (unsigned int)samples.size());
+
+    std::vector<double> values(samples.size());
+    for (size_t metric = 0; metric < metricCount; metric++)
+    {
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            values[i] = metricValue(samples[i], metric);
+        }
+        double summary[percentileCount];
+        summarize(values, summary);
+        fprintf(file, "    \"%s\": {", metricNames[metric]);
+        for (size_t i = 0; i < percentileCount; i++)
+        {
+            fprintf(file, "%s\"%s\": %.4f", i ? ", " : " ", percentileNames[i], summary[i]);
+        }
+        fprintf(file, " }%s\n", metric + 1 < metricCount ? "," : "");
+    }
+
+    unsigned int histogram[histogramBuckets] = {};
+    for (const BenchmarkFrame& frame : samples)
+    {
+        size_t bucket = std::lower_bound(histogramEdges, histogramEdges + histogramBuckets - 1, frame.frameMs) - histogramEdges;
+        histogram[bucket]++;
+    }
+    fprintf(file, "  },\n  \"frameMsHistogram\": [\n");
+    for (size_t i = 0; i < histogramBuckets; i++)
+    {
+        if (i + 1 < histogramBuckets)
+        {
+            fprintf(file, "    { \"upToMs\": %.2f, \"frames\": %u },\n", histogramEdges[i], histogram[i]);
+        }
+        else
+        {
+            fprintf(file, "    { \"upToMs\": null, \"frames\": %u }\n", histogram[i]);
+        }
+    }
+    fprintf(file, "  ]\n}\n");
+    //A full disk shows up here rather than at open, and a cut off report must not count as written
+    bool failed = ferror(file) != 0;
+    if (fclose(file) != 0 || failed)
+    {
+        std::cout << "ERROR::BENCHMARK::WRITE_FAILED " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::string Benchmark::describe() const
+{
+    std::vector<double> values(samples.size());
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        values[i] = samples[i].frameMs;
+    }
+    double summary[percentileCount];
+    summarize(values, summary);
+    char line[256];
+    snprintf(line, sizeof(line), "Benchmark: %u frames, frame time mean %.2f ms, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms",
+        (unsigned int)samples.size(), summary[0], summary[1], summary[2], summary[3], summary[4]);
+    return line;
+}
+
+//The reports are only ever written by writeReport, so reading them back just looks for the keys it writes
+//rather than parsing JSON in general
+struct BenchmarkReport
+{
+    std::string scene;
+    double metrics[metricCount][percentileCount] = {};
+};
+
+static bool readReport(const std::string& path, BenchmarkReport& report)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cout << "ERROR::BENCHMARK::READ_FAILED " << path << std::endl;
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string text = contents.str();
+
+    size_t scene = text.find("\"scene\": \"");
+    if (scene != std::string::npos)
+    {
+        scene += strlen("\"scene\": \"");
+        report.scene = text.substr(scene, text.find('"', scene) - scene);
+    }
+    for (size_t metric = 0; metric < metricCount; metric++)
+    {
+        size_t start = text.find(std::string("\"") + metricNames[metric] + "\": {");
+        size_t end = start == std::string::npos ? std::string::npos : text.find('}', start);
+        if (end == std::string::npos)
+        {
+            std::cout << "ERROR::BENCHMARK::MISSING_METRIC " << metricNames[metric] << " in " << path << std::endl;
+            return false;
+        }
+        for (size_t i = 0; i < percentileCount; i++)
+        {
+            size_t key = text.find(std::string("\"") + percentileNames[i] + "\": ", start);
+            if (key == std::string::npos || key > end)
+            {
+                std::cout << "ERROR::BENCHMARK::MISSING_METRIC " << metricNames[metric] << "." << percentileNames[i] << " in " << path << std::endl;
+                return false;
+            }
+            report.metrics[metric][i] = strtod(text.c_str() + key + strlen(percentileNames[i]) + 4, nullptr);
+        }
+    }
+    return true;
+}
+
+int compareBenchmarks(const std::string& baselinePath, const std::string& resultPath, double threshold)
+{
+    BenchmarkReport baseline, result;
+    if (!readReport(baselinePath, baseline) || !readReport(resultPath, result))
+    {
+        return -1;
+    }
+    if (baseline.scene != result.scene)
+    {
+        std::cout << "Compare: warning, the baseline ran scene " << baseline.scene << " and the result " << result.scene << std::endl;
+    }
+
+    int regressions = 0;
+    for (size_t metric = 0; metric < metricCount; metric++)
+    {
+        bool time = metric < 3;
+        //The mean is left out, it moves with every outlier and the percentiles already cover those
+        for (size_t i = 1; i < percentileCount; i++)
+        {
+            double before = baseline.metrics[metric][i];
+            double after = result.metrics[metric][i];
+            double change = before > 0.0 ? (after - before) / before : (after > 0.0 ? 1.0 : 0.0);
+            bool regressed = change > threshold && (!time || after - before > noiseFloorMs);
+            //The max is reported but never fails the comparison, one hitch decides it
+            bool gated = i != percentileCount - 1;
+            char line[160];
+            snprintf(line, sizeof(line), "  %-10s %-4s %10.3f -> %10.3f  %+7.1f%%%s", metricNames[metric], percentileNames[i],
+                before, after, change * 100.0, regressed ? (gated ? "  REGRESSION" : "  (worse)") : "");
+            std::cout << line << std::endl;
+            if (regressed && gated)
+            {
+                regressions++;
+            }
+        }
+    }
+    std::cout << "Compare: " << regressions << " regressions past " << threshold * 100.0 << "% against " << baselinePath << std::endl;
+    return regressions;
+}
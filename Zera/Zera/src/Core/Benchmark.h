@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+//What the benchmark records for one frame
+struct BenchmarkFrame
+{
+    //Wall time since the previous frame
+    double frameMs;
+    //Main thread recording plus the renderer's execute, the CPU work the frame cost
+    double cpuMs;
+    double gpuMs;
+    unsigned int drawCalls;
+    unsigned int stateCalls;
+};
+
+//Written into the report so results from different scenes, sizes or drivers are not compared by mistake
+struct BenchmarkInfo
+{
+    std::string scene;
+    unsigned int objects = 0;
+    int width = 0;
+    int height = 0;
+    bool headless = false;
+    std::string gl;
+};
+
+//The benchmark skips warmupFrames frames, while shaders, caches and the GPU profiler settle, then records the next
+//frames and reports each metric's mean, p50, p95, p99 and max plus a histogram of frame times as JSON.
+//Percentiles are nearest rank over the recorded frames.
+class Benchmark
+{
+public:
+    Benchmark(unsigned int warmupFrames, unsigned int frames);
+
+    void addFrame(const BenchmarkFrame& frame);
+    bool isDone() const { return samples.size() >= frames; }
+    unsigned int getTotalFrames() const { return warmupFrames + frames; }
+    unsigned int getRecordedFrames() const { return (unsigned int)samples.size(); }
+
+    bool writeReport(const std::string& path, const BenchmarkInfo& info) const;
+    //One line with the frame time percentiles, for the console
+    std::string describe() const;
+
+private:
+    unsigned int warmupFrames;
+    unsigned int frames;
+    unsigned int skipped = 0;
+    std::vector<BenchmarkFrame> samples;
+};
+
+//This compares two benchmark reports metric by metric and prints the differences. A percentile counts as a
+//regression when it got worse by more than threshold (0.1 is 10%), and for times also by more than a noise floor.
+//Returns the number of regressions, or -1 if either report could not be read.
+int compareBenchmarks(const std::string& baselinePath, const std::string& resultPath, double threshold);
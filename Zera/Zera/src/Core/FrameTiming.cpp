@@ -0,0 +1,113 @@
+#include "Core/FrameTiming.h"
+#include "Core/Profiler.h"
+
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+//Sleeps can overshoot by about this much, so the last part of a wait is yielded through instead
+static const std::chrono::microseconds spinMargin(1500);
+
+double getTimeSeconds()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+FixedTimestep::FixedTimestep(double stepSeconds, unsigned int maxSteps)
+    : step(stepSeconds), maxSteps(maxSteps)
+{
+}
+
+unsigned int FixedTimestep::advance(double frameSeconds)
+{
+    accumulator += frameSeconds > 0.0 ? frameSeconds : 0.0;
+    unsigned int steps = (unsigned int)(accumulator / step);
+    if (steps > maxSteps)
+    {
+        droppedSeconds += (steps - maxSteps) * step;
+        accumulator -= (steps - maxSteps) * step;
+        steps = maxSteps;
+    }
+    accumulator -= steps * step;
+    return steps;
+}
+
+FramePacer::FramePacer()
+{
+#ifdef _WIN32
+    //Windows 10 1803 and later, older versions fail here and fall back to sleep_for
+    timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+}
+
+FramePacer::~FramePacer()
+{
+#ifdef _WIN32
+    if (timer)
+    {
+        CloseHandle((HANDLE)timer);
+    }
+#endif
+}
+
+void FramePacer::setTargetFps(double fps)
+{
+    targetFps = fps > 0.0 ? fps : 0.0;
+    frameDuration = targetFps > 0.0 ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / targetFps))
+        : std::chrono::steady_clock::duration(0);
+    nextFrame = std::chrono::steady_clock::now() + frameDuration;
+}
+
+void FramePacer::sleepFor(std::chrono::steady_clock::duration duration)
+{
+#ifdef _WIN32
+    if (timer)
+    {
+        //Relative due times are negative, in 100 ns units
+        LARGE_INTEGER due;
+        due.QuadPart = -(LONGLONG)(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / 100);
+        if (SetWaitableTimer((HANDLE)timer, &due, 0, NULL, NULL, FALSE))
+        {
+            WaitForSingleObject((HANDLE)timer, INFINITE);
+            return;
+        }
+    }
+#endif
+    std::this_thread::sleep_for(duration);
+}
+
+double FramePacer::wait()
+{
+    if (targetFps <= 0.0)
+    {
+        return 0.0;
+    }
+    ZERA_PROFILE_SCOPE("frame pacing");
+    auto start = std::chrono::steady_clock::now();
+    //A frame that ran past its slot starts the schedule over from now
+    if (start >= nextFrame)
+    {
+        nextFrame = start + frameDuration;
+        return 0.0;
+    }
+
+    if (nextFrame - start > spinMargin)
+    {
+        sleepFor(nextFrame - start - spinMargin);
+    }
+    while (std::chrono::steady_clock::now() < nextFrame)
+    {
+        std::this_thread::yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+    nextFrame += frameDuration;
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
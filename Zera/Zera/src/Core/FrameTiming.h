@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+
+//Seconds on the steady clock since the first call. Frame times and input timestamps both use it, so they share a
+//time base whether or not there is a window system to ask.
+double getTimeSeconds();
+
+//The fixed timestep turns the real time between frames into a whole number of simulation steps of one fixed
+//length, so the simulation runs at the same speed and gives the same results at any frame rate. Time left over
+//carries into the next frame, and alpha says how far between the last two steps the frame is, for rendering
+//to interpolate with. After a long stall (a breakpoint, a window drag) only maxSteps are run and the rest of the
+//time is dropped, otherwise catching up would make the next frame slower still.
+class FixedTimestep
+{
+public:
+    FixedTimestep(double stepSeconds, unsigned int maxSteps);
+
+    //This adds a frame's real time and returns how many steps to run for it
+    unsigned int advance(double frameSeconds);
+    double getStep() const { return step; }
+    //Between 0 and 1, how far the leftover time is into the next step
+    double getAlpha() const { return accumulator / step; }
+    //Simulation time dropped so far because of maxSteps
+    double getDroppedSeconds() const { return droppedSeconds; }
+
+private:
+    double step;
+    unsigned int maxSteps;
+    double accumulator = 0.0;
+    double droppedSeconds = 0.0;
+};
+
+//The frame pacer holds each frame back until its slot on a fixed frame time comes up. It sleeps through most of
+//the wait, so the CPU is idle rather than spinning, and yields through the last stretch where sleeping is too
+//coarse to land on time. Late frames push the schedule forward instead of rushing the next ones to catch up.
+class FramePacer
+{
+public:
+    FramePacer();
+    ~FramePacer();
+
+    //0 turns pacing off and wait returns immediately
+    void setTargetFps(double fps);
+    double getTargetFps() const { return targetFps; }
+    //This waits until the next frame is due, returns how long it waited in milliseconds
+    double wait();
+
+private:
+    //This sleeps for about the given time, as precisely as the platform allows
+    void sleepFor(std::chrono::steady_clock::duration duration);
+
+    double targetFps = 0.0;
+    std::chrono::steady_clock::duration frameDuration{ 0 };
+    std::chrono::steady_clock::time_point nextFrame;
+    //A high resolution waitable timer on Windows, where plain sleeps round up to the 15.6 ms tick
+    void* timer = nullptr;
+};
@@ -0,0 +1,319 @@
+#include "Core/GLContext.h"
+
+#ifndef ZERA_HEADLESS_ONLY
+#include <glfw3.h>
+#endif
+#ifdef ZERA_EGL
+//The EGL context never touches a window system, so eglplatform.h has no reason to pull in the X11 headers
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include <cstring>
+#include <iostream>
+
+//Whether the created context is an EGL one, which decides where getContextProcAddress looks entry points up
+static bool eglLoader = false;
+
+#ifdef ZERA_EGL
+//This checks EGL's client extensions, the ones that work before there is a display
+static bool hasClientExtension(const char* name)
+{
+    const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (!extensions)
+    {
+        return false;
+    }
+    size_t length = strlen(name);
+    for (const char* found = strstr(extensions, name); found; found = strstr(found + length, name))
+    {
+        if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0'))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//A display to try for the headless context, and what to call it in the log
+struct HeadlessDisplay
+{
+    EGLDisplay display;
+    const char* description;
+};
+
+//This lists the displays with no window system behind them, best first: EGL devices with a DRM device file (GPUs),
+//then the other devices (Mesa's software device), then Mesa's surfaceless platform, which renders wherever Mesa can
+static int getHeadlessDisplays(HeadlessDisplay* displays, int capacity)
+{
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (!getPlatformDisplay)
+    {
+        return 0;
+    }
+    int count = 0;
+    if (hasClientExtension("EGL_EXT_platform_device"))
+    {
+        auto queryDevices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+        auto queryDeviceString = (PFNEGLQUERYDEVICESTRINGEXTPROC)eglGetProcAddress("eglQueryDeviceStringEXT");
+        EGLDeviceEXT devices[16];
+        EGLint deviceCount = 0;
+        if (queryDevices && queryDeviceString && queryDevices(16, devices, &deviceCount))
+        {
+            for (int pass = 0; pass < 2; pass++)
+            {
+                for (EGLint i = 0; i < deviceCount && count < capacity; i++)
+                {
+                    bool hardware = queryDeviceString(devices[i], EGL_DRM_DEVICE_FILE_EXT) != nullptr;
+                    if (hardware == (pass == 0))
+                    {
+                        displays[count++] = { getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[i], nullptr),
+                            hardware ? "EGL device" : "EGL software device" };
+                    }
+                }
+            }
+        }
+    }
+    if (hasClientExtension("EGL_MESA_platform_surfaceless") && count < capacity)
+    {
+        displays[count++] = { getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr), "EGL surfaceless" };
+    }
+    return count;
+}
+
+//This makes a GL 3.3 context on the display current with no surface, the renderer's offscreen output is the only
+//framebuffer it ever draws to
+static EGLContext createSurfacelessContext(EGLDisplay display)
+{
+    if (!eglInitialize(display, nullptr, nullptr))
+    {
+        return EGL_NO_CONTEXT;
+    }
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context") || !eglBindAPI(EGL_OPENGL_API))
+    {
+        eglTerminate(display);
+        return EGL_NO_CONTEXT;
+    }
+    //Without a surface the config only has to say desktop GL, and some displays have no configs at all
+    const EGLint configAttributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0)
+    {
+        if (!strstr(extensions, "EGL_KHR_no_config_context"))
+        {
+            eglTerminate(display);
+            return EGL_NO_CONTEXT;
+        }
+        config = nullptr;
+    }
+    //GL 3.3 with the compatibility profile, the same context a GLFW window gets by default
+    const EGLint contextAttributes[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT, EGL_NONE };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (context != EGL_NO_CONTEXT && eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        return context;
+    }
+    if (context != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(display, context);
+    }
+    eglTerminate(display);
+    return EGL_NO_CONTEXT;
+}
+
+static bool createEGLContext(GLContext& context)
+{
+    HeadlessDisplay displays[17];
+    int displayCount = getHeadlessDisplays(displays, 17);
+    for (int i = 0; i < displayCount; i++)
+    {
+        if (displays[i].display == EGL_NO_DISPLAY)
+        {
+            continue;
+        }
+        EGLContext eglContext = createSurfacelessContext(displays[i].display);
+        if (eglContext != EGL_NO_CONTEXT)
+        {
+            context.eglDisplay = displays[i].display;
+            context.eglContext = eglContext;
+            context.description = displays[i].description;
+            eglLoader = true;
+            return true;
+        }
+    }
+    std::cout << "Hey man your EGL is messed up, none of its " << displayCount << " headless displays made a GL 3.3 context" << std::endl;
+    return false;
+}
+#endif
+
+bool createContext(GLContext& context, int width, int height, bool headless)
+{
+    context = GLContext();
+    eglLoader = false;
+#ifdef ZERA_EGL
+    if (headless)
+    {
+        return createEGLContext(context);
+    }
+#endif
+#ifdef ZERA_HEADLESS_ONLY
+    std::cout << "Hey man this build has no window system, it can only run headless" << std::endl;
+    return false;
+#else
+    // Setup that inits glfw
+    bool softwareContext = false;
+    if (!glfwInit())
+    {
+        //A headless run on a machine with no display still gets a context from OSMesa on the null platform
+        if (!headless)
+        {
+            std::cout << "Hey man your glfw is messed up" << std::endl;
+            return false;
+        }
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        if (!glfwInit())
+        {
+            std::cout << "Hey man your glfw is messed up, even without a display" << std::endl;
+            return false;
+        }
+        softwareContext = true;
+    }
+
+    //Headless the window is only there for its context and is never shown
+    if (headless)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
+    if (softwareContext)
+    {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    }
+    context.window = glfwCreateWindow(width, height, "Zera", 0, NULL);
+    if (!context.window)
+    {
+        std::cout << "Hey man your window is messed up" << std::endl;
+        glfwTerminate();
+        return false;
+    }
+    context.description = softwareContext ? "OSMesa" : (headless ? "hidden window" : "window");
+    glfwMakeContextCurrent(context.window);
+    return true;
+#endif
+}
+
+void destroyContext(GLContext& context)
+{
+#ifdef ZERA_EGL
+    if (context.eglContext)
+    {
+        eglMakeCurrent(context.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(context.eglDisplay, context.eglContext);
+        eglTerminate(context.eglDisplay);
+    }
+#endif
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        glfwTerminate();
+    }
+#endif
+    context = GLContext();
+}
+
+void makeContextCurrent(const GLContext& context)
+{
+#ifdef ZERA_EGL
+    if (context.eglContext)
+    {
+        eglMakeCurrent(context.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, context.eglContext);
+        return;
+    }
+#endif
+#ifndef ZERA_HEADLESS_ONLY
+    glfwMakeContextCurrent(context.window);
+#endif
+}
+
+void releaseContext(const GLContext& context)
+{
+#ifdef ZERA_EGL
+    if (context.eglContext)
+    {
+        eglMakeCurrent(context.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        return;
+    }
+#endif
+#ifndef ZERA_HEADLESS_ONLY
+    glfwMakeContextCurrent(NULL);
+#endif
+}
+
+void swapContextBuffers(const GLContext& context)
+{
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        glfwSwapBuffers(context.window);
+    }
+#endif
+}
+
+void pollWindowEvents(const GLContext& context)
+{
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        glfwPollEvents();
+    }
+#endif
+}
+
+bool windowShouldClose(const GLContext& context)
+{
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        return glfwWindowShouldClose(context.window) != 0;
+    }
+#endif
+    return false;
+}
+
+void closeWindow(const GLContext& context)
+{
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        glfwSetWindowShouldClose(context.window, GLFW_TRUE);
+    }
+#endif
+}
+
+void setWindowTitle(const GLContext& context, const char* title)
+{
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        glfwSetWindowTitle(context.window, title);
+    }
+#endif
+}
+
+void* getContextProcAddress(const char* name)
+{
+#ifdef ZERA_EGL
+    if (eglLoader)
+    {
+        return (void*)eglGetProcAddress(name);
+    }
+#endif
+#ifndef ZERA_HEADLESS_ONLY
+    return (void*)glfwGetProcAddress(name);
+#else
+    return nullptr;
+#endif
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+struct GLFWwindow;
+
+//The GL context the engine draws with. Normally it belongs to a GLFW window. Headless, where the build has EGL
+//(ZERA_EGL, the Linux build), it is an EGL context made straight from the GPU, or from Mesa's software renderer
+//when there is no GPU, with no window system or display at all. It has no default framebuffer, so it is only used
+//with the renderer's offscreen output. Headless without EGL it is a hidden GLFW window, falling back to GLFW's
+//null platform with OSMesa when there is no display.
+//Builds without GLFW (ZERA_HEADLESS_ONLY) can only make the EGL context.
+struct GLContext
+{
+    //Null for an EGL context
+    GLFWwindow* window = nullptr;
+    void* eglDisplay = nullptr;
+    void* eglContext = nullptr;
+    //What the context runs on, for the log, like "window" or "EGL surfaceless"
+    const char* description = "";
+};
+
+//This creates the context and makes it current on the calling thread, printing what went wrong if it cannot
+bool createContext(GLContext& context, int width, int height, bool headless);
+//This destroys the context and shuts the window system down
+void destroyContext(GLContext& context);
+
+//This makes the context current on the calling thread
+void makeContextCurrent(const GLContext& context);
+//This lets go of the context on the calling thread so another thread can make it current
+void releaseContext(const GLContext& context);
+//This presents the window's back buffer, there is nothing to present for an EGL context
+void swapContextBuffers(const GLContext& context);
+
+//The window's side of the context, these do nothing (windowShouldClose returns false) when there is no window
+void pollWindowEvents(const GLContext& context);
+bool windowShouldClose(const GLContext& context);
+void closeWindow(const GLContext& context);
+void setWindowTitle(const GLContext& context, const char* title);
+
+//GL entry point loader for the created context, for glad and the shader manager
+void* getContextProcAddress(const char* name);
@@ -0,0 +1,145 @@
+#include "Core/Input.h"
+#include "Core/FrameTiming.h"
+
+#include <glfw3.h>
+
+//A build without GLFW has no window to take input from, events can still be pushed by hand
+#ifndef ZERA_HEADLESS_ONLY
+static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    inputQueue().push({ InputEvent::Key, key, action, 0.0, 0.0, getTimeSeconds() });
+}
+
+static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+    inputQueue().push({ InputEvent::MouseButton, button, action, 0.0, 0.0, getTimeSeconds() });
+}
+
+static void cursorPositionCallback(GLFWwindow* window, double x, double y)
+{
+    inputQueue().push({ InputEvent::CursorMove, 0, 0, x, y, getTimeSeconds() });
+}
+
+static void scrollCallback(GLFWwindow* window, double x, double y)
+{
+    inputQueue().push({ InputEvent::Scroll, 0, 0, x, y, getTimeSeconds() });
+}
+#endif
+
+void InputQueue::install(GLFWwindow* window)
+{
+#ifndef ZERA_HEADLESS_ONLY
+    glfwSetKeyCallback(window, keyCallback);
+    glfwSetMouseButtonCallback(window, mouseButtonCallback);
+    glfwSetCursorPosCallback(window, cursorPositionCallback);
+    glfwSetScrollCallback(window, scrollCallback);
+#endif
+}
+
+bool InputQueue::push(const InputEvent& event)
+{
+    uint32_t current = head.load(std::memory_order_relaxed);
+    if (current - tail.load(std::memory_order_acquire) >= capacity)
+    {
+        dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+    events[current & (capacity - 1)] = event;
+    head.store(current + 1, std::memory_order_release);
+    return true;
+}
+
+bool InputQueue::pop(InputEvent& event)
+{
+    uint32_t current = tail.load(std::memory_order_relaxed);
+    if (current == head.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    event = events[current & (capacity - 1)];
+    tail.store(current + 1, std::memory_order_release);
+    return true;
+}
+
+InputQueue& inputQueue()
+{
+    static InputQueue queue;
+    return queue;
+}
+
+unsigned int InputActions::addAction(const char* name)
+{
+    Action action;
+    action.name = name;
+    actions.push_back(action);
+    return (unsigned int)actions.size() - 1;
+}
+
+void InputActions::bindKey(unsigned int action, int key)
+{
+    bindings.push_back({ InputEvent::Key, key, action });
+}
+
+void InputActions::bindMouseButton(unsigned int action, int button)
+{
+    bindings.push_back({ InputEvent::MouseButton, button, action });
+}
+
+void InputActions::update(InputQueue& queue)
+{
+    for (Action& action : actions)
+    {
+        action.pressed = false;
+        action.released = false;
+    }
+    scrollX = 0.0;
+    scrollY = 0.0;
+    latencyMs = 0.0;
+    eventCount = 0;
+
+    double now = getTimeSeconds();
+    InputEvent event;
+    while (queue.pop(event))
+    {
+        if (eventCount++ == 0)
+        {
+            latencyMs = (now - event.time) * 1000.0;
+        }
+        switch (event.type)
+        {
+        case InputEvent::CursorMove:
+            cursorX = event.x;
+            cursorY = event.y;
+            break;
+        case InputEvent::Scroll:
+            scrollX += event.x;
+            scrollY += event.y;
+            break;
+        default:
+            //Repeats only keep a held key held, they are not new presses
+            if (event.action == GLFW_REPEAT)
+            {
+                break;
+            }
+            for (const Binding& binding : bindings)
+            {
+                if (binding.type != event.type || binding.code != event.code)
+                {
+                    continue;
+                }
+                Action& action = actions[binding.action];
+                if (event.action == GLFW_PRESS)
+                {
+                    action.pressed |= action.down == 0;
+                    action.down++;
+                }
+                else if (action.down > 0)
+                {
+                    action.down--;
+                    action.released |= action.down == 0;
+                }
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+struct GLFWwindow;
+
+//One key, button, cursor or scroll change as GLFW reported it, stamped with getTimeSeconds when it arrived
+struct InputEvent
+{
+    enum Type : uint8_t
+    {
+        Key,
+        MouseButton,
+        CursorMove,
+        Scroll
+    };
+
+    Type type;
+    //GLFW key or mouse button, and GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+    int code;
+    int action;
+    //Cursor position for CursorMove, offsets for Scroll
+    double x, y;
+    double time;
+};
+
+//The input queue carries events from the GLFW callbacks to whoever consumes them, a single producer single
+//consumer ring with no locks. The callbacks run inside glfwPollEvents, so the queue never waits on the frame
+//and the frame never waits on the queue. A full queue drops the newest events and counts them.
+class InputQueue
+{
+public:
+    static const uint32_t capacity = 1024;
+
+    //This points the window's key, mouse button, cursor and scroll callbacks at the queue
+    void install(GLFWwindow* window);
+
+    //Producer side, returns false if the queue was full
+    bool push(const InputEvent& event);
+    //Consumer side, returns false once the queue is empty
+    bool pop(InputEvent& event);
+
+    uint64_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    InputEvent events[capacity];
+    std::atomic<uint32_t> head{ 0 };
+    std::atomic<uint32_t> tail{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+};
+
+//The input queue every window's callbacks push into
+InputQueue& inputQueue();
+
+//The action map turns raw events into named actions the game asks about ("quit", "pause") instead of keys, so
+//bindings can change without touching the code that reads them. update drains the queue, call it as late in the
+//frame as possible, right before the simulation steps, so they see the freshest input there is.
+class InputActions
+{
+public:
+    //This adds an action and returns its id, actions start with no bindings
+    unsigned int addAction(const char* name);
+    void bindKey(unsigned int action, int key);
+    void bindMouseButton(unsigned int action, int button);
+
+    //This drains every queued event into the actions, the cursor and the scroll wheel
+    void update(InputQueue& queue);
+
+    //Whether the action is held now, and whether it went down or up during the last update
+    bool isDown(unsigned int action) const { return actions[action].down > 0; }
+    bool wasPressed(unsigned int action) const { return actions[action].pressed; }
+    bool wasReleased(unsigned int action) const { return actions[action].released; }
+
+    double getCursorX() const { return cursorX; }
+    double getCursorY() const { return cursorY; }
+    //Scrolled since the last update
+    double getScrollX() const { return scrollX; }
+    double getScrollY() const { return scrollY; }
+    //How long the oldest event of the last update sat in the queue before it was used, 0 if there were none
+    double getLatencyMs() const { return latencyMs; }
+    unsigned int getEventCount() const { return eventCount; }
+
+private:
+    struct Action
+    {
+        const char* name;
+        //How many of the action's bindings are held, so two keys on one action do not release each other
+        int down = 0;
+        bool pressed = false;
+        bool released = false;
+    };
+
+    struct Binding
+    {
+        InputEvent::Type type;
+        int code;
+        unsigned int action;
+    };
+
+    std::vector<Action> actions;
+    std::vector<Binding> bindings;
+    double cursorX = 0.0, cursorY = 0.0;
+    double scrollX = 0.0, scrollY = 0.0;
+    double latencyMs = 0.0;
+    unsigned int eventCount = 0;
+};
@@ -0,0 +1,171 @@
+#include "Core/Profiler.h"
+#include "Core/TraceFile.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ProfilerDetail
+{
+    std::atomic<bool> enabled{ false };
+
+    struct Event
+    {
+        const char* name;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    //One thread's zones, written only by that thread and read only by the collector. The indices only ever grow,
+    //the slot is the index masked by the capacity.
+    struct ThreadRing
+    {
+        static const uint32_t capacity = 1 << 16;
+        Event events[capacity];
+        std::atomic<uint32_t> head{ 0 };
+        std::atomic<uint32_t> tail{ 0 };
+        //Only the owning thread writes this, so it is bumped with a plain load and store rather than an atomic add
+        std::atomic<uint64_t> dropped{ 0 };
+        unsigned int track = 0;
+        std::string name;
+    };
+
+    //Rings live until the program exits, so a thread can finish without the collector losing its last zones
+    static std::mutex ringsMutex;
+    static std::vector<std::unique_ptr<ThreadRing>> rings;
+    static thread_local ThreadRing* threadRing = nullptr;
+    static thread_local const char* threadName = nullptr;
+
+    static std::thread collector;
+    static std::atomic<bool> collecting{ false };
+    //The tick and trace time taken together when the profiler started and at the last drain. Ticks are converted
+    //back from the newest pair using the rate measured over the whole run, which keeps the error from clock
+    //reads small without stopping to calibrate.
+    static uint64_t firstTick = 0;
+    static double firstTraceUs = 0.0;
+    static uint64_t anchorTick = 0;
+    static double anchorTraceUs = 0.0;
+    static double ticksPerUs = 0.0;
+
+    static ThreadRing* registerThread()
+    {
+        std::unique_ptr<ThreadRing> ring(new ThreadRing());
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ring->name = threadName ? threadName : "Thread " + std::to_string(rings.size() + 1);
+        ring->track = traceFile().addTrack(ring->name.c_str());
+        rings.push_back(std::move(ring));
+        return rings.back().get();
+    }
+
+    void record(const char* name, uint64_t start, uint64_t end)
+    {
+        ThreadRing* ring = threadRing;
+        if (!ring)
+        {
+            ring = threadRing = registerThread();
+        }
+        uint32_t head = ring->head.load(std::memory_order_relaxed);
+        if (head - ring->tail.load(std::memory_order_acquire) >= ThreadRing::capacity)
+        {
+            ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        ring->events[head & (ThreadRing::capacity - 1)] = { name, start, end };
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    static void calibrate()
+    {
+        anchorTick = ticks();
+        anchorTraceUs = traceFile().toTraceUs(std::chrono::steady_clock::now());
+        if (anchorTraceUs > firstTraceUs && anchorTick > firstTick)
+        {
+            ticksPerUs = (double)(anchorTick - firstTick) / (anchorTraceUs - firstTraceUs);
+        }
+    }
+
+    static double toTraceUs(uint64_t tick)
+    {
+        return anchorTraceUs - (double)(int64_t)(anchorTick - tick) / ticksPerUs;
+    }
+
+    static void drain()
+    {
+        calibrate();
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (std::unique_ptr<ThreadRing>& ring : rings)
+        {
+            uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+            uint32_t head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; tail++)
+            {
+                const Event& event = ring->events[tail & (ThreadRing::capacity - 1)];
+                double start = toTraceUs(event.start);
+                traceFile().addEvent(ring->track, event.name, start, toTraceUs(event.end) - start);
+            }
+            ring->tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    static void collect()
+    {
+        while (collecting.load(std::memory_order_acquire))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            drain();
+        }
+    }
+}
+
+void profilerSetThreadName(const char* name)
+{
+    ProfilerDetail::threadName = name;
+}
+
+void profilerStart()
+{
+    using namespace ProfilerDetail;
+    if (collecting.load())
+    {
+        return;
+    }
+    //The rate needs a short interval to start from, later drains stretch it over the whole run
+    firstTick = ticks();
+    firstTraceUs = traceFile().toTraceUs(std::chrono::steady_clock::now());
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    calibrate();
+
+    collecting.store(true);
+    collector = std::thread(collect);
+    enabled.store(true);
+}
+
+void profilerStop()
+{
+    using namespace ProfilerDetail;
+    if (!collecting.load())
+    {
+        return;
+    }
+    enabled.store(false);
+    collecting.store(false);
+    collector.join();
+    drain();
+}
+
+ProfilerStats profilerGetStats()
+{
+    using namespace ProfilerDetail;
+    ProfilerStats stats;
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    stats.threads = (unsigned int)rings.size();
+    for (std::unique_ptr<ThreadRing>& ring : rings)
+    {
+        stats.zones += ring->head.load(std::memory_order_relaxed);
+        stats.dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ZERA_PROFILER_RDTSC 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#include <chrono>
+#endif
+
+//The CPU profiler records scoped zones with as little work on the hot path as possible: two reads of the time
+//stamp counter and one write into a ring that belongs to the calling thread, with no locks and no allocation.
+//A collector thread drains every thread's ring into the trace file (see TraceFile.h) in the background, where
+//ticks are converted to trace time. A thread whose ring is full drops zones instead of waiting.
+//Zones cost nothing but one relaxed load while the profiler is stopped, so they stay in release builds. Defining
+//ZERA_SHIPPING compiles them out entirely.
+//Ticks come from rdtsc on x86, which assumes an invariant TSC (every x86 CPU from the last decade), and from the
+//steady clock elsewhere.
+
+//Everything in here is shared by the zones, the collector and the threads registering rings
+namespace ProfilerDetail
+{
+    extern std::atomic<bool> enabled;
+    void record(const char* name, uint64_t start, uint64_t end);
+
+    inline uint64_t ticks()
+    {
+#ifdef ZERA_PROFILER_RDTSC
+        return __rdtsc();
+#else
+        return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+}
+
+//Records the time from its construction to its destruction under name, which has to be a string literal
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char* zoneName)
+        : name(zoneName), start(ProfilerDetail::enabled.load(std::memory_order_relaxed) ? ProfilerDetail::ticks() : 0)
+    {
+    }
+    ~ProfileZone()
+    {
+        if (start)
+        {
+            ProfilerDetail::record(name, start, ProfilerDetail::ticks());
+        }
+    }
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    uint64_t start;
+};
+
+#define ZERA_PROFILE_CONCAT_INNER(a, b) a##b
+#define ZERA_PROFILE_CONCAT(a, b) ZERA_PROFILE_CONCAT_INNER(a, b)
+#ifndef ZERA_SHIPPING
+//Profiles the rest of the enclosing block as a zone called name
+#define ZERA_PROFILE_SCOPE(name) ProfileZone ZERA_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+#define ZERA_PROFILE_SCOPE(name)
+#endif
+
+struct ProfilerStats
+{
+    unsigned int threads = 0;
+    uint64_t zones = 0;
+    //Zones lost because a thread's ring was full when it wrote them
+    uint64_t dropped = 0;
+};
+
+//This names the calling thread's track in the trace, call it before the thread's first zone
+void profilerSetThreadName(const char* name);
+//This starts recording zones and the collector thread, the trace file has to be open already
+void profilerStart();
+//This stops recording, drains what is left into the trace and joins the collector
+void profilerStop();
+ProfilerStats profilerGetStats();
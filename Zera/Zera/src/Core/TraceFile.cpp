@@ -0,0 +1,81 @@
+#include "Core/TraceFile.h"
+
+#include <iostream>
+
+bool TraceFile::open(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file)
+    {
+        return false;
+    }
+    file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        std::cout << "ERROR::TRACEFILE::OPEN_FAILED " << path << std::endl;
+        return false;
+    }
+    start = std::chrono::steady_clock::now();
+    tracks = 0;
+    firstEvent = true;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    opened.store(true, std::memory_order_release);
+    return true;
+}
+
+void TraceFile::close()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!file)
+    {
+        return;
+    }
+    fputs("\n]}\n", file);
+    fclose(file);
+    file = nullptr;
+    opened.store(false, std::memory_order_release);
+}
+
+void TraceFile::writeSeparator()
+{
+    if (!firstEvent)
+    {
+        fputs(",\n", file);
+    }
+    firstEvent = false;
+}
+
+unsigned int TraceFile::addTrack(const char* name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    unsigned int track = ++tracks;
+    if (file)
+    {
+        //Tracks are threads of one process as far as the viewer is concerned, the metadata event names them
+        writeSeparator();
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", track, name);
+    }
+    return track;
+}
+
+void TraceFile::addEvent(unsigned int track, const char* name, double startUs, double durationUs)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!file)
+    {
+        return;
+    }
+    writeSeparator();
+    fprintf(file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", name, track, startUs, durationUs);
+}
+
+double TraceFile::toTraceUs(std::chrono::steady_clock::time_point time) const
+{
+    return std::chrono::duration<double, std::micro>(time - start).count();
+}
+
+TraceFile& traceFile()
+{
+    static TraceFile trace;
+    return trace;
+}
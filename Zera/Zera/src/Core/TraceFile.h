@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+//The trace file records timed events in the Chrome trace event format, so a run can be opened in
+//chrome://tracing or Perfetto and read as a timeline. Each source of events (the GPU, a thread) gets its own
+//track. Times are microseconds since the trace was opened, on the steady clock. Events can be added from any
+//thread, and adding one while no trace is open does nothing.
+class TraceFile
+{
+public:
+    bool open(const std::string& path);
+    //This finishes the JSON and closes the file, events added after this are dropped
+    void close();
+    bool isOpen() const { return opened.load(std::memory_order_acquire); }
+
+    //This names a new track and returns its id for addEvent
+    unsigned int addTrack(const char* name);
+    //This adds an event that started at startUs and lasted durationUs, name must not need escaping
+    void addEvent(unsigned int track, const char* name, double startUs, double durationUs);
+
+    //Where a steady clock time falls on the trace's timeline
+    double toTraceUs(std::chrono::steady_clock::time_point time) const;
+
+private:
+    void writeSeparator();
+
+    FILE* file = nullptr;
+    //Mirrors file != nullptr for isOpen, which is called from any thread without taking the mutex
+    std::atomic<bool> opened{ false };
+    std::chrono::steady_clock::time_point start;
+    unsigned int tracks = 0;
+    bool firstEvent = true;
+    std::mutex mutex;
+};
+
+//There is one trace per run, shared by everything that records into it
+TraceFile& traceFile();
@@ -1,15 +1,44 @@
 #include <glad/glad.h>
 #include <glfw3.h>
 
+#include "Core/Benchmark.h"
+#include "Core/FrameTiming.h"
+#include "Core/GLContext.h"
+#include "Core/Input.h"
+#include "Core/Profiler.h"
+#include "Core/TraceFile.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/RenderThread.h"
+#include "Renderer/ShaderManager.h"
+#include "Scenes/Scene.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 
 //This function decleration takes in a window object and it adjusts the size of the window 
 void frameBufferSizeCallback(GLFWwindow* window, int width, int height);
 //This functinon decleration processes input
-void processInput(GLFWwindow* window);
-//Screen resolution, width and height
-const int screenWidth = 800;
-const int screenHeight = 600;
+void processInput(const GLContext& context);
+//The actions the input is mapped to, Escape quits and Space pauses the simulation
+InputActions inputActions;
+unsigned int quitAction = inputActions.addAction("quit");
+unsigned int pauseAction = inputActions.addAction("pause");
+bool paused = false;
+//Screen resolution, width and height, --size changes it
+int screenWidth = 800;
+int screenHeight = 600;
+//Current framebuffer size, kept up to date by frameBufferSizeCallback and copied into every frame's command buffer
+int framebufferWidth = screenWidth;
+int framebufferHeight = screenHeight;
 
 //Vertex shader GLSL code
 const char* vertexShaderSource = "#version 330 core\n"
@@ -26,97 +55,280 @@ const char* fragmentShaderSource = "#version 330 core\n"
 "   FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
 "}\n\0";
 
-int main() {
-    // Setup that inits glfw, tells openGL what version and that we want to use modern OpenGL
-    glfwInit();
+int main(int argc, char** argv) {
+    //This reads the command line, --scene <name> runs one of the stress scenes instead of the rectangle: sprites,
+    //instancing, queue, meshes (unique meshes), triangles (one big mesh), lights (per pixel lights) or churn (state
+    //changes), --count <n> sets how many objects, triangles or lights it stresses with
+    //--no-render-thread records and draws on the main thread, which is easier to debug
+    //--no-multi-draw issues one draw call per queued command
+    //--gl33 ignores every extension past GL 3.3 and runs the plain paths
+    //--eager-gl resolves every GL entry point at startup instead of at each one's first call
+    //--trace <file> writes a Chrome trace of the run with CPU zones and GPU scopes (chrome://tracing or Perfetto can open it)
+    //--swap-interval <n> waits for n vertical blanks per swap, 0 turns vsync off (default 1). Builds without GLFW
+    //never swap and ignore it.
+    //--fps <n> paces frames to n per second on the CPU, for when vsync is off or the display is faster (default off)
+    //--tick-rate <n> runs the simulation in fixed steps of 1/n seconds (default 60)
+    //--frame-budget <ms> renders the scene at a lower resolution whenever the GPU frame time goes over ms, then
+    //scales it up to the window, --min-scale and --max-scale bound the resolution (default 0.5 and 1)
+    //--size <w>x<h> sets the window size (default 800x600)
+    //--frames <n> exits after n frames (default 0, run until the window closes)
+    //--headless never shows the window and renders into an offscreen framebuffer, 600 frames unless --frames says
+    //otherwise. Builds with EGL (the CMake build on Linux) make the context straight from EGL with no window system
+    //or display, others use a hidden window and without a display fall back to GLFW's null platform with OSMesa.
+    //A build without GLFW always runs headless.
+    //--benchmark <scene> runs the scene with vsync off, skips --warmup frames (default 60), records the next --frames
+    //(default 600) and writes their percentiles to --benchmark-output (default benchmark.json). Benchmark and headless
+    //runs exit with 1 when anything stops them, so CI never takes a failed run (or an old report) for a pass.
+    //--compare <baseline> <result> compares two benchmark reports and exits with 1 if anything got worse by more
+    //than --threshold percent (default 10)
+    const char* sceneName = nullptr;
+    int sceneCount = 0;
+    bool useRenderThread = true;
+    bool multiDraw = true;
+    bool core33 = false;
+    bool lazyGL = true;
+    const char* tracePath = nullptr;
+#ifndef ZERA_HEADLESS_ONLY
+    int swapInterval = 1;
+    bool swapIntervalSet = false;
+#endif
+    double targetFps = 0.0;
+    double tickRate = 60.0;
+    double frameBudgetMs = 0.0;
+    float minScale = 0.5f;
+    float maxScale = 1.0f;
+    bool headless = false;
+    int maxFrames = -1;
+    bool benchmark = false;
+    int warmupFrames = 60;
+    const char* benchmarkOutput = "benchmark.json";
+    const char* compareBaseline = nullptr;
+    const char* compareResult = nullptr;
+    double threshold = 10.0;
+    std::string shaderCacheDirectory = "shadercache";
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--scene") == 0 && i + 1 < argc)
+        {
+            sceneName = argv[++i];
+        }
+        else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+        {
+            sceneCount = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--no-render-thread") == 0)
+        {
+            useRenderThread = false;
+        }
+        else if (strcmp(argv[i], "--no-multi-draw") == 0)
+        {
+            multiDraw = false;
+        }
+        else if (strcmp(argv[i], "--gl33") == 0)
+        {
+            core33 = true;
+        }
+        else if (strcmp(argv[i], "--eager-gl") == 0)
+        {
+            lazyGL = false;
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            tracePath = argv[++i];
+        }
+#ifndef ZERA_HEADLESS_ONLY
+        else if (strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc)
+        {
+            swapInterval = atoi(argv[++i]);
+            swapIntervalSet = true;
+        }
+#endif
+        else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc)
+        {
+            targetFps = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc)
+        {
+            tickRate = atof(argv[++i]);
+            if (tickRate <= 0.0)
+            {
+                tickRate = 60.0;
+            }
+        }
+        else if (strcmp(argv[i], "--frame-budget") == 0 && i + 1 < argc)
+        {
+            frameBudgetMs = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--min-scale") == 0 && i + 1 < argc)
+        {
+            minScale = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--max-scale") == 0 && i + 1 < argc)
+        {
+            maxScale = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            int width = 0, height = 0;
+            if (sscanf(argv[++i], "%dx%d", &width, &height) == 2 && width > 0 && height > 0)
+            {
+                screenWidth = width;
+                screenHeight = height;
+            }
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            maxFrames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--headless") == 0)
+        {
+            headless = true;
+        }
+        else if (strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc)
+        {
+            benchmark = true;
+            sceneName = argv[++i];
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+        {
+            warmupFrames = std::max(0, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--benchmark-output") == 0 && i + 1 < argc)
+        {
+            benchmarkOutput = argv[++i];
+        }
+        else if (strcmp(argv[i], "--compare") == 0 && i + 2 < argc)
+        {
+            compareBaseline = argv[++i];
+            compareResult = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+        {
+            threshold = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--shader-cache") == 0 && i + 1 < argc)
+        {
+            shaderCacheDirectory = argv[++i];
+        }
+        else if (strcmp(argv[i], "--no-shader-cache") == 0)
+        {
+            shaderCacheDirectory.clear();
+        }
+    }
 
-    //This creates a window object pointer and assigning it to the glfwcreate window output
-    GLFWwindow* window = glfwCreateWindow(screenWidth, screenHeight, "Zera", 0, NULL);
+    //Comparing reports needs no window or GL at all
+    if (compareBaseline)
+    {
+        int regressions = compareBenchmarks(compareBaseline, compareResult, threshold / 100.0);
+        return regressions < 0 ? 2 : (regressions > 0 ? 1 : 0);
+    }
 
-      //This checks to see if there was an error in making the opengl window
-      if (!window) 
-      {
-       std::cout << "Hey man your window is messed up" << std::endl;
-       return 0;
-      }
+    //A benchmark measures what the engine can do, so vsync only caps it if asked for explicitly, and its frame
+    //limit covers the warm up as well as the frames it records
+    if (benchmark)
+    {
+#ifndef ZERA_HEADLESS_ONLY
+        if (!swapIntervalSet)
+        {
+            swapInterval = 0;
+        }
+#endif
+        if (maxFrames <= 0)
+        {
+            maxFrames = 600;
+        }
+    }
+    Benchmark benchmarkRun(warmupFrames, benchmark ? maxFrames : 0);
+    if (benchmark)
+    {
+        maxFrames = benchmarkRun.getTotalFrames();
+        //A report left over from an earlier run must not be mistaken for this run's if this one fails, so it is
+        //emptied now, which --compare rejects
+        if (FILE* staleReport = fopen(benchmarkOutput, "w"))
+        {
+            fclose(staleReport);
+        }
+    }
 
-    //This tells opengl what window we are working with
-    glfwMakeContextCurrent(window);
-    //Opengl calls this to adjust the window size
-    glfwSetFramebufferSizeCallback(window, frameBufferSizeCallback);
+    //The trace is opened before anything else so everything that records into it finds it open
+    profilerSetThreadName("Main");
+    if (tracePath && traceFile().open(tracePath))
+    {
+        profilerStart();
+    }
 
-     //This function checks for GLAD errors
-      if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) 
+    //Startup is timed in steps so slow launches can be pinned on the window system, the driver or the loader
+    auto startupStart = std::chrono::steady_clock::now();
+    auto startupStep = startupStart;
+    auto stepMs = [&startupStep]()
+    {
+        auto now = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - startupStep).count();
+        startupStep = now;
+        return ms;
+    };
+
+#ifdef ZERA_HEADLESS_ONLY
+    //There is no window system in this build to open a window with
+    headless = true;
+#endif
+    if (maxFrames < 0)
+    {
+        maxFrames = headless ? 600 : 0;
+    }
+    //Nobody watches benchmark and headless runs, the exit code is how their failures get noticed. Interactive runs
+    //keep exiting with 0 as they always have.
+    int failureExitCode = (benchmark || headless) ? EXIT_FAILURE : 0;
+
+    //This creates the window and its GL context and makes the context current, headless there may be no window at all
+    GLContext context;
+    if (!createContext(context, screenWidth, screenHeight, headless))
+    {
+        return failureExitCode;
+    }
+    double contextMs = stepMs();
+
+#ifndef ZERA_HEADLESS_ONLY
+    if (context.window)
+    {
+        //This sets how many vertical blanks each swap waits for, it sticks to the context when the render thread
+        //takes it. Headless never swaps.
+        if (!headless)
+        {
+            glfwSwapInterval(swapInterval);
+        }
+        //Opengl calls this to adjust the window size, headless frames keep the size they were asked for
+        if (!headless)
+        {
+            glfwSetFramebufferSizeCallback(context.window, frameBufferSizeCallback);
+        }
+        //This sends the window's keys, mouse buttons, cursor and scroll into the input queue
+        inputQueue().install(context.window);
+    }
+#endif
+    inputActions.bindKey(quitAction, GLFW_KEY_ESCAPE);
+    inputActions.bindKey(pauseAction, GLFW_KEY_SPACE);
+
+     //This function checks for GLAD errors. Lazily, only the entry points we actually call ever get looked up.
+      if (!(lazyGL ? gladLoadGLLoaderLazy : gladLoadGLLoader)((GLADloadproc)getContextProcAddress)) 
        {
        std::cout << "Hey man your glad is messed up" << std::endl;
-       return 0;
+       destroyContext(context);
+       return failureExitCode;
        }
+    double loaderMs = stepMs();
 
+    //This decides which GL paths everything after this point uses, so it has to come before anything is created
+    probeCapabilities(core33);
+    std::string capabilities = describeCapabilities();
+    std::cout << capabilities << std::endl;
 
-    // This is an unsigned int vertex shader that holds the reference number (ID) for a shader object created by OpenGL.
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    // This function takes in our vertexShader number and vertex shader source code
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    //This compiles the shader into GPU code
-    glCompileShader(vertexShader);
-
-    // This int is to hold the value of a returned OpenGL error code
-    int success;
-    // This is a "String" in C as the OpenGL functions use C
-    char infoLog [512];
-    // This function logs the compile status of the vertexShader, as specified in the second parameter
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    // This checks to see if success is equal to 0
-      if (!success) 
-      { 
-          // This gets the info log from open gl
-          glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-          // This prints the error log from the vertex shader
-          std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-      }
-
-    //This is providing a reference number of the newly made fragment shader object
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    //This provides openGL with the fragment shader code
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    // This compiles the fragment shader into GPU code
-    glCompileShader(fragmentShader);
-    //This gets the compile status and success numnber for the fragment shader
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    //This checks if Success is equal to 0
-      if (!success)
-      {
-          //This stores the fragment shader infoLog information
-          glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-          //Logs the information
-          std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-         }
-
-
-
-    //This is an unsigned int that is provided a refrence number to a created program
-    unsigned int shaderProgram = glCreateProgram();
-    //This stages the already compiled vertex and fragment shaders on to the GPU
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    //This links together all of the shader prgrams that are compiled on the GPU
-    glLinkProgram(shaderProgram);
-    //This gets the compile status of the shader program
-    glGetShaderiv(shaderProgram, GL_COMPILE_STATUS, &success);
-    //Checks success is equal to 0
-    if (!success)
-    {   
-        //Gets the program log info 
-        glGetShaderInfoLog(shaderProgram, 512, NULL, infoLog);
-
-        //This ouputs the log information to the console
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << std::endl;
-    }
-
-
-    //This is cleanup for the vertex and fragment shaders
-    glDeleteProgram(fragmentShader);    
-    glDeleteProgram(vertexShader);
+    //This turns on parallel shader compiling and the program binary cache when the driver supports them
+    shaderManager().init((GLADloadproc)getContextProcAddress, shaderCacheDirectory);
+
+    //This starts compiling and linking our shader program. Nothing waits for the result here, the compile
+    //runs alongside the rest of startup and the log is checked the first time the program is drawn with
+    unsigned int shaderProgram = shaderManager().submit("rectangle", vertexShaderSource, fragmentShaderSource);
 
 
     //This is an array of floats called vertices to draw our rectangle
@@ -134,103 +346,324 @@ int main() {
         1, 2, 3  // second Triangle
     };
 
-    //Unsigned ints for the VBO, VAO, EBO;
-    unsigned int VBO, VAO, EBO;
-
-    //This is generating one vertex array object and storing its ID in VAO
-    glGenVertexArrays(1, &VAO);
-    //This generates a buffer object with memory we can work with on the gpu and stores its ID in VBO
-    glGenBuffers(1, &VBO);
-    //This generates a buffer object with memory we can work with on the gpu and stores its ID in EBO
-    glGenBuffers(1, &EBO);
-    //This function by "Binding the vertexarray" it basically activates the VAO making it the active current one (openGL is a state machine)
-    glBindVertexArray(VAO);
-    //This binds the buffer, basically enabling the VBO
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    //This tells opengl to allocate memory on the GPU for our vertices
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    //This binds the EBO Array buffer object and lets it be modifyable by openGL
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    //THis tells opengl to allocate memory on the GPU for the indices
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    //This tells opengl how to interperate the data 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    //This assignes the vertex array to 0 so we don't accidentally modify it
-    glBindVertexArray(0);
-    //This assignes the buffer to 0, so we don't accidently write to it
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    // remember: do NOT unbind the EBO while a VAO is active as the bound element buffer object IS stored in the VAO; keep the EBO bound.
-    //glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-
-    // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
-    // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
-    glBindVertexArray(0);
+    //This puts our rectangle into the geometry pool, which keeps every mesh's vertices and indices in a few big
+    //buffers shared between them. The VAO belongs to the pool page and reads the buffers as X, Y, Z positions,
+    //positionLayout tells opengl how to interpret the data and is checked against PositionVertex when compiling
+    static_assert(sizeof(vertices) % sizeof(PositionVertex) == 0, "the rectangle vertices must be whole PositionVertex entries");
+    geometryPool().init(8 * 1024 * 1024);
+    Mesh rectangleMesh = createMesh(vertices, 4, indices, 6);
+    unsigned int VAO = rectangleMesh.VAO;
 
     // uncomment this call to draw in wireframe polygons.
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
+    //This sets up the renderer that executes every frame's command buffer
+    Renderer renderer;
+    if (!renderer.init())
+    {
+        std::cout << "Hey man your renderer is messed up" << std::endl;
+        destroyContext(context);
+        return failureExitCode;
+    }
+    renderer.setMultiDraw(multiDraw);
+    renderer.setDynamicResolution(frameBudgetMs, minScale, maxScale);
+    renderer.setOffscreenOutput(headless);
+
+    //This creates the stress scene if one was asked for on the command line
+    Scene* scene = nullptr;
+    if (sceneName)
+    {
+        scene = createScene(sceneName, sceneCount);
+        if (!scene || !scene->init(renderer))
+        {
+            std::cout << "Hey man your scene is messed up: " << sceneName << " (scenes: " << sceneNames << ")" << std::endl;
+            //This frees whatever the scene made before its init failed
+            if (scene)
+            {
+                scene->shutdown(renderer);
+            }
+            delete scene;
+            renderer.shutdown();
+            destroyContext(context);
+            return failureExitCode;
+        }
+    }
+
+    //This checks the rectangle's VAO against the shader now that every shader has been submitted
+    shaderManager().validateVertexInputs(shaderProgram, VAO, "rectangle");
+
+    //This reports how full the geometry pool is once everything is loaded and how scattered its free space is
+    GeometryPool::Stats geometryStats = geometryPool().getStats();
+    std::cout << "Geometry: " << geometryStats.meshes << " meshes in " << geometryStats.pages << " pages, vertices "
+        << geometryStats.vertexBytesUsed << "/" << geometryStats.vertexBytes << " bytes, indices " << geometryStats.indexBytesUsed
+        << "/" << geometryStats.indexBytes << " bytes, " << geometryStats.freeRanges << " free ranges, fragmentation "
+        << geometryStats.fragmentation * 100.0f << "%, " << geometryStats.compactions << " compactions (" << geometryStats.compactMs << " ms)" << std::endl;
+
+    //This reports where startup went, loading covers shaders, meshes, the renderer and the scene
+    double loadingMs = stepMs();
+    std::cout << "Startup: window and context " << contextMs << " ms (" << context.description << "), GL loader " << loaderMs << " ms ("
+        << (lazyGL ? "lazy" : "eager") << "), loading " << loadingMs << " ms, total "
+        << std::chrono::duration<double, std::milli>(startupStep - startupStart).count() << " ms" << std::endl;
+
+    //This hands the GL context to the render thread, from here on the main thread only records command buffers
+    //Headless the frames are the size asked for, whatever the hidden window's framebuffer is
+    if (headless)
+    {
+        framebufferWidth = screenWidth;
+        framebufferHeight = screenHeight;
+    }
+#ifndef ZERA_HEADLESS_ONLY
+    else
+    {
+        glfwGetFramebufferSize(context.window, &framebufferWidth, &framebufferHeight);
+    }
+#endif
+    RenderThread renderThread;
+    renderThread.start(context, &renderer, useRenderThread, headless);
+    if (headless)
+    {
+        std::cout << "Headless: " << framebufferWidth << "x" << framebufferHeight << " for " << maxFrames << " frames"
+            << " on " << context.description << std::endl;
+    }
+
+    //This runs the simulation in fixed steps no matter the frame rate, at most 5 a frame so a stall does not
+    //turn into a spiral of ever longer catch up frames
+    FixedTimestep timestep(1.0 / tickRate, 5);
+    //This holds frames back to the target frame time, with vsync on the swap already paces and this stays off
+    FramePacer pacer;
+    pacer.setTargetFps(targetFps);
+
+    //These track the frame times so we can print the scene stats once a second
+    double lastFrameTime = getTimeSeconds();
+    double lastReportTime = lastFrameTime;
+    int framesSinceReport = 0;
+    double recordMs = 0.0;
+    double pacingMs = 0.0;
+    double inputLatencyMs = 0.0;
+    unsigned int stepsSinceReport = 0;
+    int frameCount = 0;
+
     //This is our main while loop that checks if the the glfw window should close
     // -----------
-    while (!glfwWindowShouldClose(window))
+    while (!windowShouldClose(context) && (maxFrames == 0 || frameCount < maxFrames))
     {
+        ZERA_PROFILE_SCOPE("main frame");
 
+        //This grabs the command buffer for this frame, it only waits if the render thread is a whole frame behind
+        CommandBuffer& frame = renderThread.beginFrame();
 
-        //This processes the input of the current window object
+        //This polls and processes the input only now that every wait of the frame is behind us, so the simulation
+        //steps on the freshest input there is
         // -----
-        processInput(window);
-
-        //This clears the screen to make a color appear 
-        // ------
-        glClearColor(0.3f, 0.1f, 0.2f, 1.0f);
-        //This fills in the color the previous glclearcolor provided
-        glClear(GL_COLOR_BUFFER_BIT);
-        //This tells opengl that we want to use the shader program
-        glUseProgram(shaderProgram);
-        //This binds the vao so we can access the memeory
-        glBindVertexArray(VAO);
-        //glDrawArrays(GL_TRIANGLES, 0, 6);
-        //This draws the elements of the 2 triangles
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-        //This swapps the buffers within the window object
-        glfwSwapBuffers(window);
-        // -------------------------------------------------------------------------------
-        //This preforms and pending poll events
-        glfwPollEvents();
-    }
-
-    //This deletes the shader program, VAO, VBO, EBO
+        pollWindowEvents(context);
+        processInput(context);
+        inputLatencyMs = std::max(inputLatencyMs, inputActions.getLatencyMs());
+
+        double frameTime = getTimeSeconds();
+        float deltaTime = (float)(frameTime - lastFrameTime);
+        lastFrameTime = frameTime;
+
+        //This turns the time since the last frame into fixed simulation steps, none while paused
+        unsigned int steps = timestep.advance(paused ? 0.0 : deltaTime);
+        float step = (float)timestep.getStep();
+        stepsSinceReport += steps;
+
+        auto recordStart = std::chrono::steady_clock::now();
+        frame.width = framebufferWidth;
+        frame.height = framebufferHeight;
+        frame.time = (float)frameTime;
+        frame.deltaTime = deltaTime;
+        //This is the color the screen gets cleared to
+        frame.clearColor[0] = 0.3f;
+        frame.clearColor[1] = 0.1f;
+        frame.clearColor[2] = 0.2f;
+        frame.clearColor[3] = 1.0f;
+
+        if (scene)
+        {
+            ZERA_PROFILE_SCOPE("scene update and record");
+            //This moves the scene forward in whole steps and lets it record its draws at the current framebuffer
+            //size, in between the last two steps by however far the frame is into the next one
+            for (unsigned int i = 0; i < steps; i++)
+            {
+                scene->update(step, frame.width, frame.height);
+            }
+            scene->record(frame, (float)timestep.getAlpha());
+        }
+        else
+        {
+            //This queues the 2 triangles of our rectangle with our shader program and VAO
+            RenderCommand rectangle = {};
+            rectangle.program = shaderProgram;
+            GeometryRange range = getMeshRange(rectangleMesh);
+            rectangle.vertexArray = VAO;
+            rectangle.indexCount = rectangleMesh.indexCount;
+            rectangle.firstIndex = range.firstIndex;
+            rectangle.baseVertex = range.baseVertex;
+            DrawConstants constants = {};
+            frame.queue.push(rectangle, constants);
+        }
+        recordMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - recordStart).count();
+
+        //This hands the frame to the render thread which draws it and swaps the buffers within the window object
+        renderThread.endFrame();
+        frameCount++;
+
+        //This records the frame for the benchmark, the renderer's side comes from the newest frame it finished
+        if (benchmark)
+        {
+            const RenderStats& renderStats = renderThread.getLastStats();
+            benchmarkRun.addFrame({ deltaTime * 1000.0, recordMs + renderStats.executeMs, renderStats.gpuFrameMs,
+                renderStats.drawCalls, renderStats.stateCalls });
+        }
+
+        //This prints the scene stats once a second
+        framesSinceReport++;
+        if (scene && frameTime - lastReportTime >= 1.0)
+        {
+            const SceneStats& stats = scene->getStats();
+            const RenderStats& renderStats = renderThread.getLastStats();
+            //The GPU passes read like "queue 4.10 instances 0.02 sprites 0.01"
+            char gpuPasses[160] = "";
+            size_t gpuLength = 0;
+            for (unsigned int i = 0; i < renderStats.gpuPassCount && gpuLength < sizeof(gpuPasses); i++)
+            {
+                gpuLength += snprintf(gpuPasses + gpuLength, sizeof(gpuPasses) - gpuLength, "%s%s %.2f", i ? " " : "",
+                    renderStats.gpuPasses[i].name, renderStats.gpuPasses[i].ms);
+            }
+            char title[640];
+            snprintf(title, sizeof(title), "Zera | %s | %u objects | %u draws/frame (%u multi) | %u state calls (%u skipped) | record %.2f ms | execute %.2f ms (sort %.2f ms) | gpu %.2f ms (%s) | res %dx%d (%.0f%%) | waits main %.2f render %.2f ms | ring %.1f%% (fence wait %.2f ms) | %.1f ticks/s%s | pacing %.2f ms | input %.2f ms | %.1f fps",
+                scene->getName(), stats.objects, renderStats.drawCalls, renderStats.multiDraws, renderStats.stateCalls, renderStats.stateCallsSkipped, recordMs, renderStats.executeMs, renderStats.sortMs,
+                renderStats.gpuFrameMs, gpuPasses, renderStats.renderWidth, renderStats.renderHeight, renderStats.renderScale * 100.0f, renderThread.getMainWaitMs(), renderThread.getRenderWaitMs(),
+                renderStats.streamCapacity ? 100.0 * renderStats.streamBytes / renderStats.streamCapacity : 0.0, renderStats.streamWaitMs,
+                stepsSinceReport / (frameTime - lastReportTime), paused ? " (paused)" : "", pacingMs, inputLatencyMs, framesSinceReport / (frameTime - lastReportTime));
+            setWindowTitle(context, title);
+            std::cout << title << std::endl;
+            lastReportTime = frameTime;
+            framesSinceReport = 0;
+            stepsSinceReport = 0;
+            inputLatencyMs = 0.0;
+        }
+
+        //This sleeps off whatever is left of the frame time when a target frame rate is set
+        pacingMs = pacer.wait();
+    }
+
+    //This waits for the render thread to finish its frames and takes the GL context back for cleanup
+    renderThread.stop();
+
+    //This writes the benchmark report while the scene is still around to describe itself. A run that ended early
+    //(the window was closed) has too few frames to stand for the scene and writes no report.
+    int exitCode = 0;
+    if (benchmark && !benchmarkRun.isDone())
+    {
+        std::cout << "ERROR::BENCHMARK::INCOMPLETE only " << benchmarkRun.getRecordedFrames() << " frames were recorded, no report written" << std::endl;
+        exitCode = failureExitCode;
+    }
+    else if (benchmark)
+    {
+        BenchmarkInfo info;
+        info.scene = sceneName;
+        info.objects = scene ? scene->getStats().objects : 0;
+        info.width = framebufferWidth;
+        info.height = framebufferHeight;
+        info.headless = headless;
+        info.gl = capabilities;
+        if (benchmarkRun.writeReport(benchmarkOutput, info))
+        {
+            std::cout << benchmarkRun.describe() << ", report in " << benchmarkOutput << std::endl;
+        }
+        else
+        {
+            exitCode = failureExitCode;
+        }
+    }
+
+    //This lets the scene clean up its own GL objects before the context goes away
+    if (scene)
+    {
+        scene->shutdown(renderer);
+        delete scene;
+    }
+    renderer.shutdown();
+
+    //This reports how often window resizes reallocated the render targets and how often the pool saved one
+    const RenderTargetPool::Stats& targetStats = renderer.getTargetPoolStats();
+    if (targetStats.created)
+    {
+        const ResizeCoordinator::Stats& resizeStats = renderer.getResizeStats();
+        std::cout << "Render targets: " << targetStats.created << " created, " << targetStats.reused << " reused, " << targetStats.freed
+            << " freed, " << resizeStats.resizes << " resizes, " << resizeStats.reallocations << " reallocations, "
+            << resizeStats.deferredFrames << " frames drawn at the old size" << std::endl;
+    }
+
+    //This deletes the shader program and gives the rectangle's space back to the pool
     // ------------------------------------------------------------------------
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
-    glDeleteProgram(shaderProgram);
+    destroyMesh(rectangleMesh);
+    shaderManager().release(shaderProgram);
+
+    //This reports how long startup spent issuing shader work versus waiting on it. A warm start is one where every
+    //program came out of the binary cache, run twice to compare it against the cold start.
+    const ShaderManager::Stats& shaderStats = shaderManager().getStats();
+    const char* startKind = !shaderStats.binaryCache ? "uncached" :
+        (shaderStats.cacheHits == shaderStats.submitted && shaderStats.cacheStale == 0) ? "warm" : "cold";
+    std::cout << "Shaders: " << shaderStats.submitted << " programs (" << shaderStats.failed << " failed), " << startKind
+        << " start " << shaderStats.submitMs + shaderStats.resolveMs << " ms (submit " << shaderStats.submitMs
+        << " ms, waited " << shaderStats.resolveMs << " ms at first use), cache " << shaderStats.cacheHits << " hits "
+        << shaderStats.cacheMisses << " misses " << shaderStats.cacheStale << " stale, parallel compile "
+        << (shaderStats.parallelCompile ? "on" : "off") << std::endl;
+    //This reports what the scene's meshes take on the GPU next to what they would take stored as plain floats
+    const MeshMemory& meshMemory = getMeshMemory();
+    if (meshMemory.meshes)
+    {
+        std::cout << "Meshes: " << meshMemory.meshes << " meshes, " << meshMemory.vertices << " vertices, "
+            << meshMemory.vertexBytes << " vertex bytes (" << meshMemory.floatVertexBytes << " as floats)" << std::endl;
+    }
+    shaderManager().shutdown();
+    geometryPool().shutdown();
+    vertexArrays().shutdown();
+    //This drains the last zones into the trace before it is closed
+    if (traceFile().isOpen())
+    {
+        profilerStop();
+        ProfilerStats profilerStats = profilerGetStats();
+        std::cout << "Profiler: " << profilerStats.zones << " zones on " << profilerStats.threads << " threads, "
+            << profilerStats.dropped << " dropped" << std::endl;
+    }
+    traceFile().close();
 
-    //This terminates glfw
-    glfwTerminate();
+    //This destroys the context and terminates glfw
+    destroyContext(context);
     // ------------------------------------------------------------------
-    //returns 0
-return 0;
+    //returns 0, or the failure exit code if the benchmark could not be recorded
+return exitCode;
 }
 
 
 //This function is for processing the input of our glfw window object
 // ---------------------------------------------------------------------------------------------------------
-void processInput(GLFWwindow* window) {
-    //This is the if statment for the glfwgetkey and checks for escape
-    if (GLFW_KEY_ESCAPE)
+void processInput(const GLContext& context) {
+    ZERA_PROFILE_SCOPE("processInput");
+    //This drains the events the callbacks queued up since last frame into the actions
+    inputActions.update(inputQueue());
+    //This checks for escape and closes the window
+    if (inputActions.wasPressed(quitAction))
     {
-        //This closes the window
-        glfwWindowShouldClose(window);
-    }   
+        closeWindow(context);
+    }
+    //This checks for space and freezes or resumes the simulation
+    if (inputActions.wasPressed(pauseAction))
+    {
+        paused = !paused;
+    }
 }
     
 
 
 //This function framebuffer_size_callbeack is responsible for taking the window, width and height// ---------------------------------------------------------------------------------------------
+//The GL context lives on the render thread, so this only remembers the size and the next frame's viewport picks it up
     void frameBufferSizeCallback(GLFWwindow* window, int width, int height) 
     {
-        glViewport(0,0, width, height);
+        framebufferWidth = width;
+        framebufferHeight = height;
     }
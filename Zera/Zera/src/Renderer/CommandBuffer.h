@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Renderer/InstanceBatch.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/SpriteBatch.h"
+
+//GPU time of one of the renderer's passes, from the GPU profiler
+struct GpuPassTime
+{
+    const char* name;
+    unsigned int depth;
+    double ms;
+};
+
+//What the renderer measured while executing a command buffer
+struct RenderStats
+{
+    unsigned int drawCalls = 0;
+    //Draw calls that were multi draws covering several queue commands
+    unsigned int multiDraws = 0;
+    unsigned int stateCalls = 0;
+    unsigned int stateCallsSkipped = 0;
+    double executeMs = 0.0;
+    double sortMs = 0.0;
+    //How much of the streaming ring the frame used and how long it waited on fences for space
+    size_t streamBytes = 0;
+    size_t streamCapacity = 0;
+    double streamWaitMs = 0.0;
+    //GPU time of the frame and its passes. The GPU runs behind, so these are from a frame a few frames back.
+    double gpuFrameMs = 0.0;
+    static const unsigned int maxGpuPasses = 16;
+    GpuPassTime gpuPasses[maxGpuPasses] = {};
+    unsigned int gpuPassCount = 0;
+    //The size the scene was rendered at and its fraction of the window, below 1 when dynamic resolution scaled it down
+    int renderWidth = 0;
+    int renderHeight = 0;
+    float renderScale = 1.0f;
+};
+
+//Everything one frame wants drawn. The main thread records into a command buffer without touching GL,
+//then hands it to the renderer (usually on the render thread) to execute. Nothing in here owns GL objects,
+//and clearing keeps the storage around so recording a frame does not allocate once it has warmed up.
+struct CommandBuffer
+{
+    float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    int width = 0;
+    int height = 0;
+    //Seconds since startup and since the last frame, for the frame constants block
+    float time = 0.0f;
+    float deltaTime = 0.0f;
+
+    RenderQueue queue;
+    InstanceBatch instances;
+    SpriteBatch sprites;
+
+    //Written by the renderer when the buffer is executed
+    RenderStats stats;
+
+    void clear()
+    {
+        queue.clear();
+        instances.clear();
+        sprites.clear();
+    }
+};
@@ -0,0 +1,53 @@
+#include "Renderer/GLCapabilities.h"
+
+#include <glad/glad.h>
+
+static GLCapabilities capabilities;
+
+void probeCapabilities(bool core33)
+{
+    capabilities = GLCapabilities();
+    if (core33)
+    {
+        return;
+    }
+
+    //Drivers have been known to list an extension and not export every function, so the pointers are checked too
+    capabilities.bufferStorage = GLAD_GL_ARB_buffer_storage && glBufferStorage;
+    capabilities.multiDrawIndirect = GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_draw_indirect && glMultiDrawElementsIndirect;
+    capabilities.directStateAccess = GLAD_GL_ARB_direct_state_access && glCreateBuffers && glNamedBufferStorage && glNamedBufferSubData &&
+        glCopyNamedBufferSubData && glCreateTextures && glTextureStorage2D && glTextureSubImage2D && glTextureParameteri &&
+        glCreateFramebuffers && glCreateRenderbuffers && glNamedRenderbufferStorage && glNamedFramebufferTexture &&
+        glNamedFramebufferRenderbuffer && glCheckNamedFramebufferStatus && glBlitNamedFramebuffer;
+    capabilities.baseInstance = GLAD_GL_ARB_base_instance && glDrawElementsInstancedBaseVertexBaseInstance;
+    capabilities.textureStorage = GLAD_GL_ARB_texture_storage && glTexStorage2D;
+    capabilities.drawParameters = GLAD_GL_ARB_shader_draw_parameters != 0;
+}
+
+const GLCapabilities& glCapabilities()
+{
+    return capabilities;
+}
+
+std::string describeCapabilities()
+{
+    const char* on = "on";
+    const char* off = "off";
+    std::string description = "GL: ";
+    description += (const char*)glGetString(GL_VERSION);
+    description += " (";
+    description += (const char*)glGetString(GL_RENDERER);
+    description += ") | buffer storage ";
+    description += capabilities.bufferStorage ? on : off;
+    description += ", multi draw indirect ";
+    description += capabilities.multiDrawIndirect ? on : off;
+    description += ", direct state access ";
+    description += capabilities.directStateAccess ? on : off;
+    description += ", base instance ";
+    description += capabilities.baseInstance ? on : off;
+    description += ", texture storage ";
+    description += capabilities.textureStorage ? on : off;
+    description += ", draw parameters ";
+    description += capabilities.drawParameters ? on : off;
+    return description;
+}
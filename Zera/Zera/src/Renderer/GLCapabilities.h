@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+//Which of the newer GL paths the driver supports. The loader is built for GL 3.3 plus the extensions below, so
+//each flag means the extension (or the GL version that made it core) is there and its entry points loaded.
+//Systems check the flags when they are set up and otherwise fall back to plain GL 3.3.
+struct GLCapabilities
+{
+    //GL_ARB_buffer_storage, rings are mapped once, persistently, instead of mapped and unmapped every write
+    bool bufferStorage = false;
+    //GL_ARB_multi_draw_indirect and GL_ARB_draw_indirect, the render queue writes draws into an indirect buffer
+    bool multiDrawIndirect = false;
+    //GL_ARB_direct_state_access, buffers, textures and render targets are created and filled without binding them
+    bool directStateAccess = false;
+    //GL_ARB_base_instance, instance attributes are pointed once and draws pick their instances by base instance
+    bool baseInstance = false;
+    //GL_ARB_texture_storage, textures are allocated immutable
+    bool textureStorage = false;
+    //GL_ARB_shader_draw_parameters, shaders can read gl_DrawIDARB so multi draws can fetch per draw data
+    bool drawParameters = false;
+};
+
+//This fills in the capabilities from what glad loaded, call it once after gladLoadGLLoader and before anything
+//is created. core33 turns every fast path off so the GL 3.3 path can be tested on any driver.
+void probeCapabilities(bool core33);
+const GLCapabilities& glCapabilities();
+//The driver and which paths are on, for the startup log
+std::string describeCapabilities();
@@ -0,0 +1,313 @@
+#include "Renderer/GLStateCache.h"
+
+//Placeholder for "we do not know what the driver has", no real GL name or enum ever has this value
+static const unsigned int unknown = 0xFFFFFFFFu;
+
+GLStateCache::GLStateCache()
+{
+    reset();
+}
+
+void GLStateCache::reset()
+{
+    program = unknown;
+    vertexArray = unknown;
+    for (unsigned int& buffer : buffers)
+    {
+        buffer = unknown;
+    }
+    for (UniformRange& range : uniformRanges)
+    {
+        range.buffer = unknown;
+    }
+    activeUnit = unknown;
+    for (unsigned int unit = 0; unit < maxTextureUnits; unit++)
+    {
+        for (unsigned int& texture : textures[unit])
+        {
+            texture = unknown;
+        }
+    }
+    blend = unknown;
+    blendSource = blendDestination = unknown;
+    depthTest = unknown;
+    depthWrite = unknown;
+    depthFunction = unknown;
+    viewportRect[0] = viewportRect[1] = viewportRect[2] = viewportRect[3] = -1;
+    drawFramebuffer = readFramebuffer = unknown;
+}
+
+bool GLStateCache::changed(unsigned int& cached, unsigned int value)
+{
+    if (cached == value)
+    {
+        stats.skipped++;
+        return false;
+    }
+    cached = value;
+    stats.issued++;
+    return true;
+}
+
+int GLStateCache::bufferSlot(GLenum target)
+{
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER: return ArrayBuffer;
+    case GL_ELEMENT_ARRAY_BUFFER: return ElementArrayBuffer;
+    case GL_UNIFORM_BUFFER: return UniformBuffer;
+    case GL_COPY_READ_BUFFER: return CopyReadBuffer;
+    case GL_COPY_WRITE_BUFFER: return CopyWriteBuffer;
+    case GL_PIXEL_UNPACK_BUFFER: return PixelUnpackBuffer;
+    case GL_TEXTURE_BUFFER: return TextureBuffer;
+    case GL_DRAW_INDIRECT_BUFFER: return DrawIndirectBuffer;
+    default: return -1;
+    }
+}
+
+int GLStateCache::textureSlot(GLenum target)
+{
+    switch (target)
+    {
+    case GL_TEXTURE_2D: return Texture2D;
+    case GL_TEXTURE_2D_ARRAY: return Texture2DArray;
+    case GL_TEXTURE_CUBE_MAP: return TextureCubeMap;
+    case GL_TEXTURE_BUFFER: return TextureBufferTarget;
+    default: return -1;
+    }
+}
+
+void GLStateCache::useProgram(unsigned int value)
+{
+    if (changed(program, value))
+    {
+        glUseProgram(value);
+    }
+}
+
+void GLStateCache::bindVertexArray(unsigned int value)
+{
+    if (changed(vertexArray, value))
+    {
+        glBindVertexArray(value);
+        //The element array binding belongs to the VAO, so switching VAOs switches it too
+        buffers[ElementArrayBuffer] = unknown;
+    }
+}
+
+void GLStateCache::bindBuffer(GLenum target, unsigned int buffer)
+{
+    int slot = bufferSlot(target);
+    if (slot < 0)
+    {
+        stats.issued++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+    if (changed(buffers[slot], buffer))
+    {
+        glBindBuffer(target, buffer);
+    }
+}
+
+void GLStateCache::bindUniformRange(unsigned int binding, unsigned int buffer, size_t offset, size_t size)
+{
+    if (binding >= maxUniformBindings)
+    {
+        stats.issued++;
+        buffers[UniformBuffer] = buffer;
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, offset, size);
+        return;
+    }
+    UniformRange& range = uniformRanges[binding];
+    if (range.buffer == buffer && range.offset == offset && range.size == size)
+    {
+        stats.skipped++;
+        return;
+    }
+    range.buffer = buffer;
+    range.offset = offset;
+    range.size = size;
+    buffers[UniformBuffer] = buffer;
+    stats.issued++;
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, offset, size);
+}
+
+void GLStateCache::bindTexture(unsigned int unit, GLenum target, unsigned int texture)
+{
+    int slot = textureSlot(target);
+    if (slot < 0 || unit >= maxTextureUnits)
+    {
+        stats.issued += 2;
+        activeUnit = unit;
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, texture);
+        return;
+    }
+    if (textures[unit][slot] == texture)
+    {
+        stats.skipped++;
+        return;
+    }
+    //The active unit only has to change when the texture binding itself does
+    if (changed(activeUnit, unit))
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+    textures[unit][slot] = texture;
+    stats.issued++;
+    glBindTexture(target, texture);
+}
+
+void GLStateCache::bindFramebuffer(GLenum target, unsigned int framebuffer)
+{
+    if (target == GL_FRAMEBUFFER)
+    {
+        if (drawFramebuffer == framebuffer && readFramebuffer == framebuffer)
+        {
+            stats.skipped++;
+            return;
+        }
+        drawFramebuffer = readFramebuffer = framebuffer;
+        stats.issued++;
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        return;
+    }
+    if (changed(target == GL_READ_FRAMEBUFFER ? readFramebuffer : drawFramebuffer, framebuffer))
+    {
+        glBindFramebuffer(target, framebuffer);
+    }
+}
+
+void GLStateCache::setBlend(bool enabled)
+{
+    if (changed(blend, enabled ? 1u : 0u))
+    {
+        enabled ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+    }
+}
+
+void GLStateCache::blendFunc(GLenum source, GLenum destination)
+{
+    if (blendSource == source && blendDestination == destination)
+    {
+        stats.skipped++;
+        return;
+    }
+    blendSource = source;
+    blendDestination = destination;
+    stats.issued++;
+    glBlendFunc(source, destination);
+}
+
+void GLStateCache::setDepthTest(bool enabled)
+{
+    if (changed(depthTest, enabled ? 1u : 0u))
+    {
+        enabled ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+    }
+}
+
+void GLStateCache::depthMask(bool enabled)
+{
+    if (changed(depthWrite, enabled ? 1u : 0u))
+    {
+        glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+}
+
+void GLStateCache::depthFunc(GLenum function)
+{
+    if (changed(depthFunction, function))
+    {
+        glDepthFunc(function);
+    }
+}
+
+void GLStateCache::viewport(int x, int y, int width, int height)
+{
+    if (viewportRect[0] == x && viewportRect[1] == y && viewportRect[2] == width && viewportRect[3] == height)
+    {
+        stats.skipped++;
+        return;
+    }
+    viewportRect[0] = x;
+    viewportRect[1] = y;
+    viewportRect[2] = width;
+    viewportRect[3] = height;
+    stats.issued++;
+    glViewport(x, y, width, height);
+}
+
+void GLStateCache::deleteProgram(unsigned int value)
+{
+    if (program == value)
+    {
+        program = unknown;
+    }
+    glDeleteProgram(value);
+}
+
+void GLStateCache::deleteVertexArray(unsigned int value)
+{
+    if (vertexArray == value)
+    {
+        vertexArray = unknown;
+        buffers[ElementArrayBuffer] = unknown;
+    }
+    glDeleteVertexArrays(1, &value);
+}
+
+void GLStateCache::deleteBuffer(unsigned int value)
+{
+    for (unsigned int& buffer : buffers)
+    {
+        if (buffer == value)
+        {
+            buffer = unknown;
+        }
+    }
+    for (UniformRange& range : uniformRanges)
+    {
+        if (range.buffer == value)
+        {
+            range.buffer = unknown;
+        }
+    }
+    glDeleteBuffers(1, &value);
+}
+
+void GLStateCache::deleteTexture(unsigned int value)
+{
+    for (unsigned int unit = 0; unit < maxTextureUnits; unit++)
+    {
+        for (unsigned int& texture : textures[unit])
+        {
+            if (texture == value)
+            {
+                texture = unknown;
+            }
+        }
+    }
+    glDeleteTextures(1, &value);
+}
+
+void GLStateCache::deleteFramebuffer(unsigned int value)
+{
+    //Deleting a bound framebuffer puts the default one back
+    if (drawFramebuffer == value)
+    {
+        drawFramebuffer = 0;
+    }
+    if (readFramebuffer == value)
+    {
+        readFramebuffer = 0;
+    }
+    glDeleteFramebuffers(1, &value);
+}
+
+GLStateCache& glState()
+{
+    static GLStateCache cache;
+    return cache;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+//The state cache sits in front of the glad function pointers for the binds we do every frame. It remembers
+//what the driver currently has bound and skips calls that would not change anything, counting both kinds.
+//Everything that binds or deletes programs, VAOs, buffers, textures or framebuffers has to go through it, otherwise the
+//cached values go stale (call reset() after handing the context to code that does not know about the cache).
+class GLStateCache
+{
+public:
+    static const unsigned int maxTextureUnits = 16;
+    static const unsigned int maxUniformBindings = 16;
+
+    struct Stats
+    {
+        unsigned int issued = 0;
+        unsigned int skipped = 0;
+    };
+
+    GLStateCache();
+
+    //This forgets everything, the next call for every piece of state will go to the driver
+    void reset();
+
+    void useProgram(unsigned int program);
+    void bindVertexArray(unsigned int vertexArray);
+    void bindBuffer(GLenum target, unsigned int buffer);
+    //This binds a range of a uniform buffer to an indexed binding point, which also sets GL_UNIFORM_BUFFER
+    void bindUniformRange(unsigned int binding, unsigned int buffer, size_t offset, size_t size);
+    void bindTexture(unsigned int unit, GLenum target, unsigned int texture);
+    //GL_FRAMEBUFFER binds both the draw and the read framebuffer, like it does in GL
+    void bindFramebuffer(GLenum target, unsigned int framebuffer);
+    void setBlend(bool enabled);
+    void blendFunc(GLenum source, GLenum destination);
+    void setDepthTest(bool enabled);
+    void depthMask(bool enabled);
+    void depthFunc(GLenum function);
+    void viewport(int x, int y, int width, int height);
+
+    //Deleted names get unbound by GL and may be handed out again, so deletes have to clear the cache too
+    void deleteProgram(unsigned int program);
+    void deleteVertexArray(unsigned int vertexArray);
+    void deleteBuffer(unsigned int buffer);
+    void deleteTexture(unsigned int texture);
+    void deleteFramebuffer(unsigned int framebuffer);
+
+    const Stats& getStats() const { return stats; }
+    void resetStats() { stats = Stats(); }
+
+private:
+    //Buffer targets we track, anything else is passed straight through
+    enum BufferSlot { ArrayBuffer, ElementArrayBuffer, UniformBuffer, CopyReadBuffer, CopyWriteBuffer, PixelUnpackBuffer, TextureBuffer, DrawIndirectBuffer, BufferSlotCount };
+    //Texture targets we track per unit
+    enum TextureSlot { Texture2D, Texture2DArray, TextureCubeMap, TextureBufferTarget, TextureSlotCount };
+
+    static int bufferSlot(GLenum target);
+    static int textureSlot(GLenum target);
+    //This returns true if the call has to be made, and counts it either way
+    bool changed(unsigned int& cached, unsigned int value);
+
+    unsigned int program;
+    unsigned int vertexArray;
+    unsigned int buffers[BufferSlotCount];
+    unsigned int activeUnit;
+    unsigned int textures[maxTextureUnits][TextureSlotCount];
+    struct UniformRange
+    {
+        unsigned int buffer;
+        size_t offset;
+        size_t size;
+    };
+    UniformRange uniformRanges[maxUniformBindings];
+    unsigned int blend;
+    unsigned int blendSource, blendDestination;
+    unsigned int depthTest;
+    unsigned int depthWrite;
+    unsigned int depthFunction;
+    int viewportRect[4];
+    unsigned int drawFramebuffer;
+    unsigned int readFramebuffer;
+    Stats stats;
+};
+
+//There is one GL context and it is only touched by one thread at a time, so the cache is global like the context
+GLStateCache& glState();
@@ -0,0 +1,388 @@
+#include "Renderer/GeometryPool.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <chrono>
+
+//Buffer work goes through these so pages use direct state access when the driver has it. DSA buffers are immutable
+//storage that only takes glNamedBufferSubData and copies, and nothing has to be bound to create, fill or copy them.
+//Without it everything goes through the copy targets so the bound VAO and its index buffer are never touched.
+static unsigned int createBuffer(size_t size, GLenum usage)
+{
+    unsigned int buffer = 0;
+    if (glCapabilities().directStateAccess)
+    {
+        glCreateBuffers(1, &buffer);
+        glNamedBufferStorage(buffer, size, nullptr, GL_DYNAMIC_STORAGE_BIT);
+        return buffer;
+    }
+    glGenBuffers(1, &buffer);
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, usage);
+    return buffer;
+}
+
+static void uploadBuffer(unsigned int buffer, size_t offset, size_t size, const void* data)
+{
+    if (glCapabilities().directStateAccess)
+    {
+        glNamedBufferSubData(buffer, offset, size, data);
+        return;
+    }
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+}
+
+static void copyBuffer(unsigned int source, unsigned int destination, size_t sourceOffset, size_t destinationOffset, size_t size)
+{
+    if (glCapabilities().directStateAccess)
+    {
+        glCopyNamedBufferSubData(source, destination, sourceOffset, destinationOffset, size);
+        return;
+    }
+    glState().bindBuffer(GL_COPY_READ_BUFFER, source);
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, destination);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, destinationOffset, size);
+}
+
+void RangeAllocator::init(size_t newCapacity)
+{
+    freeByOffset.clear();
+    freeBySize.clear();
+    capacity = newCapacity;
+    used = 0;
+    if (capacity)
+    {
+        insertFree(0, capacity);
+    }
+}
+
+size_t RangeAllocator::allocate(size_t size)
+{
+    if (size == 0)
+    {
+        return invalid;
+    }
+    //Best fit keeps the big ranges whole for big meshes
+    auto best = freeBySize.lower_bound(size);
+    if (best == freeBySize.end())
+    {
+        return invalid;
+    }
+    size_t offset = best->second;
+    size_t rangeSize = best->first;
+    eraseFree(freeByOffset.find(offset));
+    if (rangeSize > size)
+    {
+        insertFree(offset + size, rangeSize - size);
+    }
+    used += size;
+    return offset;
+}
+
+void RangeAllocator::free(size_t offset, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+    used -= size;
+
+    //Merge with the free range that ends where this one starts and the one that starts where it ends
+    auto next = freeByOffset.lower_bound(offset);
+    if (next != freeByOffset.begin())
+    {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == offset)
+        {
+            offset = previous->first;
+            size += previous->second;
+            eraseFree(previous);
+        }
+    }
+    if (next != freeByOffset.end() && offset + size == next->first)
+    {
+        size += next->second;
+        eraseFree(next);
+    }
+    insertFree(offset, size);
+}
+
+void RangeAllocator::insertFree(size_t offset, size_t size)
+{
+    freeByOffset[offset] = size;
+    freeBySize.insert(std::make_pair(size, offset));
+}
+
+void RangeAllocator::eraseFree(std::map<size_t, size_t>::iterator range)
+{
+    auto bySize = freeBySize.equal_range(range->second);
+    for (auto it = bySize.first; it != bySize.second; ++it)
+    {
+        if (it->second == range->first)
+        {
+            freeBySize.erase(it);
+            break;
+        }
+    }
+    freeByOffset.erase(range);
+}
+
+void GeometryPool::init(size_t newPageBytes)
+{
+    pageBytes = newPageBytes;
+    allocations.assign(1, Allocation());
+    freeHandles.clear();
+}
+
+void GeometryPool::shutdown()
+{
+    for (Page& page : pages)
+    {
+        vertexArrays().release(page.vertexBuffer);
+        glState().deleteBuffer(page.vertexBuffer);
+        glState().deleteBuffer(page.indexBuffer);
+    }
+    pages.clear();
+    allocations.assign(1, Allocation());
+    freeHandles.clear();
+}
+
+unsigned int GeometryPool::allocate(const VertexLayout& layout, const void* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount)
+{
+    if (vertexCount == 0 || indexCount == 0)
+    {
+        return 0;
+    }
+    if (allocations.empty())
+    {
+        allocations.push_back(Allocation());
+    }
+
+    //First any page of the layout with a free range big enough, then one that has the room but needs compacting
+    //to get it in one piece, and only then a new page
+    size_t page = pages.size();
+    for (size_t i = 0; i < pages.size() && page == pages.size(); i++)
+    {
+        if (pages[i].layout == &layout && fits(pages[i], vertexCount, indexCount))
+        {
+            page = i;
+        }
+    }
+    for (size_t i = 0; i < pages.size() && page == pages.size(); i++)
+    {
+        const Page& candidate = pages[i];
+        if (candidate.layout == &layout &&
+            candidate.vertices.getCapacity() - candidate.vertices.getUsed() >= vertexCount &&
+            candidate.indices.getCapacity() - candidate.indices.getUsed() >= indexCount)
+        {
+            compactPage(i);
+            page = i;
+        }
+    }
+    if (page == pages.size())
+    {
+        page = addPage(layout, vertexCount, indexCount);
+    }
+
+    Allocation allocation;
+    allocation.page = (unsigned int)page;
+    allocation.vertexCount = vertexCount;
+    allocation.indexCount = indexCount;
+    allocation.vertexOffset = pages[page].vertices.allocate(vertexCount);
+    allocation.indexOffset = pages[page].indices.allocate(indexCount);
+    allocation.live = true;
+
+    unsigned int stride = layout.stride;
+    uploadBuffer(pages[page].vertexBuffer, allocation.vertexOffset * stride, (size_t)vertexCount * stride, vertices);
+    uploadBuffer(pages[page].indexBuffer, allocation.indexOffset * sizeof(unsigned int), indexCount * sizeof(unsigned int), indices);
+
+    unsigned int handle;
+    if (!freeHandles.empty())
+    {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+        allocations[handle] = allocation;
+    }
+    else
+    {
+        handle = (unsigned int)allocations.size();
+        allocations.push_back(allocation);
+    }
+    return handle;
+}
+
+void GeometryPool::free(unsigned int handle)
+{
+    if (handle == 0 || handle >= allocations.size() || !allocations[handle].live)
+    {
+        return;
+    }
+    Allocation& allocation = allocations[handle];
+    Page& page = pages[allocation.page];
+    page.vertices.free(allocation.vertexOffset, allocation.vertexCount);
+    page.indices.free(allocation.indexOffset, allocation.indexCount);
+    allocation.live = false;
+    freeHandles.push_back(handle);
+}
+
+void GeometryPool::compact()
+{
+    for (size_t i = 0; i < pages.size(); i++)
+    {
+        compactPage(i);
+    }
+}
+
+unsigned int GeometryPool::getVertexArray(unsigned int handle) const
+{
+    return handle && handle < allocations.size() ? pages[allocations[handle].page].vertexArray : 0;
+}
+
+GeometryRange GeometryPool::getRange(unsigned int handle) const
+{
+    if (handle == 0 || handle >= allocations.size())
+    {
+        return GeometryRange{ 0, 0 };
+    }
+    const Allocation& allocation = allocations[handle];
+    return GeometryRange{ (unsigned int)allocation.indexOffset, (int)allocation.vertexOffset };
+}
+
+GeometryPool::Stats GeometryPool::getStats() const
+{
+    Stats stats;
+    stats.pages = (unsigned int)pages.size();
+    stats.meshes = (unsigned int)(allocations.size() - (allocations.empty() ? 0 : 1) - freeHandles.size());
+    for (const Page& page : pages)
+    {
+        stats.vertexBytes += page.vertices.getCapacity() * page.layout->stride;
+        stats.vertexBytesUsed += page.vertices.getUsed() * page.layout->stride;
+        stats.indexBytes += page.indices.getCapacity() * sizeof(unsigned int);
+        stats.indexBytesUsed += page.indices.getUsed() * sizeof(unsigned int);
+        stats.freeRanges += (unsigned int)(page.vertices.getFreeRanges() + page.indices.getFreeRanges());
+        stats.fragmentation = std::max(stats.fragmentation, fragmentation(page));
+    }
+    stats.compactions = compactions;
+    stats.compactMs = compactMs;
+    return stats;
+}
+
+size_t GeometryPool::addPage(const VertexLayout& layout, size_t vertexCount, size_t indexCount)
+{
+    Page page;
+    page.layout = &layout;
+    size_t pageVertices = std::max(pageBytes / layout.stride, vertexCount);
+    size_t pageIndices = std::max(pageBytes / sizeof(unsigned int), indexCount);
+    page.vertices.init(pageVertices);
+    page.indices.init(pageIndices);
+
+    page.vertexBuffer = createBuffer(pageVertices * layout.stride, GL_STATIC_DRAW);
+    page.indexBuffer = createBuffer(pageIndices * sizeof(unsigned int), GL_STATIC_DRAW);
+
+    page.vertexArray = vertexArrays().get(layout, page.vertexBuffer, page.indexBuffer);
+    pages.push_back(page);
+    return pages.size() - 1;
+}
+
+bool GeometryPool::fits(const Page& page, size_t vertexCount, size_t indexCount) const
+{
+    return page.vertices.getLargestFree() >= vertexCount && page.indices.getLargestFree() >= indexCount;
+}
+
+void GeometryPool::compactPage(size_t pageIndex)
+{
+    Page& page = pages[pageIndex];
+    std::vector<unsigned int> live;
+    for (unsigned int handle = 1; handle < allocations.size(); handle++)
+    {
+        if (allocations[handle].live && allocations[handle].page == pageIndex)
+        {
+            live.push_back(handle);
+        }
+    }
+
+    //Ranges keep their order and close up behind each other. A page with nothing to move is left alone.
+    std::vector<size_t> vertexOffsets(allocations.size());
+    std::vector<size_t> indexOffsets(allocations.size());
+    bool moves = false;
+    size_t vertexEnd = 0;
+    std::sort(live.begin(), live.end(), [&](unsigned int a, unsigned int b) { return allocations[a].vertexOffset < allocations[b].vertexOffset; });
+    for (unsigned int handle : live)
+    {
+        vertexOffsets[handle] = vertexEnd;
+        moves |= vertexEnd != allocations[handle].vertexOffset;
+        vertexEnd += allocations[handle].vertexCount;
+    }
+    size_t indexEnd = 0;
+    std::sort(live.begin(), live.end(), [&](unsigned int a, unsigned int b) { return allocations[a].indexOffset < allocations[b].indexOffset; });
+    for (unsigned int handle : live)
+    {
+        indexOffsets[handle] = indexEnd;
+        moves |= indexEnd != allocations[handle].indexOffset;
+        indexEnd += allocations[handle].indexCount;
+    }
+    if (!moves)
+    {
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    //A buffer cannot copy onto an overlapping range of itself, so the live ranges are gathered into a scratch
+    //buffer and the packed result copied back in one go. It all stays on the GPU.
+    size_t stride = page.layout->stride;
+    unsigned int scratch = createBuffer(std::max(vertexEnd * stride, indexEnd * sizeof(unsigned int)), GL_STREAM_COPY);
+
+    for (unsigned int handle : live)
+    {
+        const Allocation& allocation = allocations[handle];
+        copyBuffer(page.vertexBuffer, scratch, allocation.vertexOffset * stride, vertexOffsets[handle] * stride, allocation.vertexCount * stride);
+    }
+    copyBuffer(scratch, page.vertexBuffer, 0, 0, vertexEnd * stride);
+
+    for (unsigned int handle : live)
+    {
+        const Allocation& allocation = allocations[handle];
+        copyBuffer(page.indexBuffer, scratch, allocation.indexOffset * sizeof(unsigned int), indexOffsets[handle] * sizeof(unsigned int), allocation.indexCount * sizeof(unsigned int));
+    }
+    copyBuffer(scratch, page.indexBuffer, 0, 0, indexEnd * sizeof(unsigned int));
+    glState().deleteBuffer(scratch);
+
+    //Indices are relative to the mesh so they copy as they are, only the offsets change
+    for (unsigned int handle : live)
+    {
+        allocations[handle].vertexOffset = vertexOffsets[handle];
+        allocations[handle].indexOffset = indexOffsets[handle];
+    }
+    page.vertices.init(page.vertices.getCapacity());
+    page.indices.init(page.indices.getCapacity());
+    page.vertices.allocate(vertexEnd);
+    page.indices.allocate(indexEnd);
+
+    compactions++;
+    compactMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+float GeometryPool::fragmentation(const Page& page) const
+{
+    float worst = 0.0f;
+    const RangeAllocator* allocators[2] = { &page.vertices, &page.indices };
+    for (const RangeAllocator* allocator : allocators)
+    {
+        size_t free = allocator->getCapacity() - allocator->getUsed();
+        if (free)
+        {
+            worst = std::max(worst, 1.0f - (float)allocator->getLargestFree() / (float)free);
+        }
+    }
+    return worst;
+}
+
+GeometryPool& geometryPool()
+{
+    static GeometryPool pool;
+    return pool;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Renderer/VertexLayout.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+//Hands out ranges of a fixed size space. Free ranges are kept twice, by offset so a freed range merges with the
+//free ranges either side of it, and by size so allocation takes the smallest range that fits.
+class RangeAllocator
+{
+public:
+    static const size_t invalid = (size_t)-1;
+
+    void init(size_t capacity);
+    //This returns the offset of a range of size units, or invalid if no free range is big enough
+    size_t allocate(size_t size);
+    void free(size_t offset, size_t size);
+
+    size_t getCapacity() const { return capacity; }
+    size_t getUsed() const { return used; }
+    size_t getFreeRanges() const { return freeByOffset.size(); }
+    size_t getLargestFree() const { return freeBySize.empty() ? 0 : freeBySize.rbegin()->first; }
+
+private:
+    void insertFree(size_t offset, size_t size);
+    void eraseFree(std::map<size_t, size_t>::iterator range);
+
+    std::map<size_t, size_t> freeByOffset;
+    std::multimap<size_t, size_t> freeBySize;
+    size_t capacity = 0;
+    size_t used = 0;
+};
+
+//Where a mesh's geometry sits right now. Compaction moves it, so draws look it up when they are recorded.
+struct GeometryRange
+{
+    unsigned int firstIndex;
+    int baseVertex;
+};
+
+//The geometry pool suballocates every static mesh from a few large pages, one vertex buffer and one index buffer
+//each, with one VAO per page. All meshes of a layout share a page until it fills, so drawing them needs no VAO
+//or buffer switches, only glDrawElementsBaseVertex with the mesh's range. Indices stay relative to the mesh,
+//the base vertex moves them onto wherever its vertices landed.
+//Pages live until shutdown so their VAO names never change. Allocation, free and compaction must happen with the
+//context current and no recorded frame still waiting to be drawn, like scene init and shutdown.
+class GeometryPool
+{
+public:
+    struct Stats
+    {
+        unsigned int pages = 0;
+        unsigned int meshes = 0;
+        size_t vertexBytes = 0;
+        size_t vertexBytesUsed = 0;
+        size_t indexBytes = 0;
+        size_t indexBytesUsed = 0;
+        unsigned int freeRanges = 0;
+        //1 - largest free range / free space on the worst page, 0 when every page's free space is in one piece
+        float fragmentation = 0.0f;
+        unsigned int compactions = 0;
+        double compactMs = 0.0;
+    };
+
+    //pageBytes is the size of each page's vertex and index buffers, meshes bigger than that get a page of their own
+    void init(size_t pageBytes);
+    void shutdown();
+
+    //This uploads the mesh into a page for its layout and returns its handle, 0 for an empty mesh
+    unsigned int allocate(const VertexLayout& layout, const void* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount);
+    void free(unsigned int handle);
+    //This slides every page's meshes down to the start of its buffers so the free space is one range again
+    void compact();
+
+    unsigned int getVertexArray(unsigned int handle) const;
+    GeometryRange getRange(unsigned int handle) const;
+    Stats getStats() const;
+
+private:
+    struct Page
+    {
+        const VertexLayout* layout;
+        unsigned int vertexBuffer;
+        unsigned int indexBuffer;
+        unsigned int vertexArray;
+        //Vertices are allocated in whole vertices so the offset is the base vertex, indices in whole indices
+        RangeAllocator vertices;
+        RangeAllocator indices;
+    };
+    struct Allocation
+    {
+        unsigned int page;
+        size_t vertexOffset;
+        size_t vertexCount;
+        size_t indexOffset;
+        size_t indexCount;
+        bool live;
+    };
+
+    size_t addPage(const VertexLayout& layout, size_t vertexCount, size_t indexCount);
+    bool fits(const Page& page, size_t vertexCount, size_t indexCount) const;
+    void compactPage(size_t page);
+    float fragmentation(const Page& page) const;
+
+    std::vector<Page> pages;
+    //Handles index this, entry 0 is never used so 0 can mean no geometry
+    std::vector<Allocation> allocations;
+    std::vector<unsigned int> freeHandles;
+    size_t pageBytes = 8 * 1024 * 1024;
+    unsigned int compactions = 0;
+    double compactMs = 0.0;
+};
+
+//Buffers and VAOs belong to the one GL context, so the pool is global like the VAO cache
+GeometryPool& geometryPool();
@@ -0,0 +1,203 @@
+#include "Renderer/GpuProfiler.h"
+#include "Core/TraceFile.h"
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <iostream>
+
+//Marks a scope begun past maxScopes, it is skipped along with its end
+static const unsigned int skippedScope = 0xFFFFFFFFu;
+//How often the GPU clock is lined up with the steady clock again, in frames
+static const uint64_t clockSyncFrames = 120;
+
+bool GpuProfiler::init()
+{
+    GLint bits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+    if (bits == 0)
+    {
+        std::cout << "ERROR::GPUPROFILER::NO_TIMESTAMP_COUNTER" << std::endl;
+        enabled = false;
+        return false;
+    }
+
+    for (FrameSlot& slot : slots)
+    {
+        glGenQueries(maxScopes * 2, slot.queries);
+        slot.scopes.reserve(maxScopes);
+        slot.pending = false;
+    }
+    results.reserve(maxScopes);
+    open.reserve(maxScopes);
+    frame = 0;
+    droppedFrames = 0;
+    current = nullptr;
+    traceTrack = traceFile().isOpen() ? traceFile().addTrack("GPU") : 0;
+    syncClocks();
+    enabled = true;
+    return true;
+}
+
+void GpuProfiler::shutdown()
+{
+    if (!enabled)
+    {
+        return;
+    }
+    for (FrameSlot& slot : slots)
+    {
+        glDeleteQueries(maxScopes * 2, slot.queries);
+        slot.scopes.clear();
+        slot.pending = false;
+    }
+    results.clear();
+    current = nullptr;
+    enabled = false;
+}
+
+void GpuProfiler::syncClocks()
+{
+    GLint64 gpuNs = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNs);
+    syncGpuNs = gpuNs;
+    syncTraceUs = traceFile().toTraceUs(std::chrono::steady_clock::now());
+}
+
+void GpuProfiler::beginFrame()
+{
+    current = nullptr;
+    open.clear();
+    if (!enabled)
+    {
+        return;
+    }
+    FrameSlot& slot = slots[frame % frameSlots];
+    //Reusing the slot's queries now would mean waiting for the GPU to finish them, so this frame goes without
+    if (slot.pending)
+    {
+        droppedFrames++;
+        return;
+    }
+    slot.scopes.clear();
+    slot.queryCount = 0;
+    slot.frame = frame;
+    current = &slot;
+}
+
+void GpuProfiler::begin(const char* name)
+{
+    if (!current)
+    {
+        return;
+    }
+    if (current->queryCount + 2 > maxScopes * 2)
+    {
+        open.push_back(skippedScope);
+        return;
+    }
+    PendingScope scope;
+    scope.name = name;
+    scope.depth = (unsigned int)open.size();
+    scope.query = current->queryCount;
+    glQueryCounter(current->queries[scope.query], GL_TIMESTAMP);
+    current->lastQuery = scope.query;
+    current->queryCount += 2;
+    open.push_back((unsigned int)current->scopes.size());
+    current->scopes.push_back(scope);
+}
+
+void GpuProfiler::end()
+{
+    if (!current || open.empty())
+    {
+        return;
+    }
+    unsigned int index = open.back();
+    open.pop_back();
+    if (index == skippedScope)
+    {
+        return;
+    }
+    unsigned int query = current->scopes[index].query + 1;
+    glQueryCounter(current->queries[query], GL_TIMESTAMP);
+    current->lastQuery = query;
+}
+
+void GpuProfiler::endFrame()
+{
+    if (!enabled)
+    {
+        return;
+    }
+    if (current)
+    {
+        while (!open.empty())
+        {
+            end();
+        }
+        current->pending = current->queryCount > 0;
+        current = nullptr;
+    }
+    frame++;
+
+    //Timestamps finish in the order they were issued, so a frame is done once its last query is, and frames are
+    //read oldest first until one is still in flight
+    while (true)
+    {
+        FrameSlot* oldest = nullptr;
+        for (FrameSlot& slot : slots)
+        {
+            if (slot.pending && (!oldest || slot.frame < oldest->frame))
+            {
+                oldest = &slot;
+            }
+        }
+        if (!oldest)
+        {
+            break;
+        }
+        GLint available = 0;
+        glGetQueryObjectiv(oldest->queries[oldest->lastQuery], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+        {
+            break;
+        }
+        resolve(*oldest);
+    }
+
+    if (frame % clockSyncFrames == 0)
+    {
+        syncClocks();
+    }
+}
+
+void GpuProfiler::resolve(FrameSlot& slot)
+{
+    GLuint64 timestamps[maxScopes * 2];
+    for (unsigned int i = 0; i < slot.queryCount; i++)
+    {
+        glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+
+    results.clear();
+    GLuint64 frameStart = timestamps[slot.scopes[0].query];
+    bool tracing = traceTrack != 0 && traceFile().isOpen();
+    for (const PendingScope& pending : slot.scopes)
+    {
+        GLuint64 begin = timestamps[pending.query];
+        GLuint64 end = timestamps[pending.query + 1];
+        Scope scope;
+        scope.name = pending.name;
+        scope.depth = pending.depth;
+        scope.startMs = (double)(int64_t)(begin - frameStart) / 1000000.0;
+        scope.ms = (double)(int64_t)(end - begin) / 1000000.0;
+        results.push_back(scope);
+        if (tracing)
+        {
+            traceFile().addEvent(traceTrack, pending.name, syncTraceUs + (double)((int64_t)begin - syncGpuNs) / 1000.0, (double)(int64_t)(end - begin) / 1000.0);
+        }
+    }
+    resultFrame = slot.frame + 1;
+    slot.pending = false;
+}
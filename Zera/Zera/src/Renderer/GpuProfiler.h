@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+//The GPU profiler times named scopes of GL work with GL_TIMESTAMP queries. Timestamps are used rather than
+//GL_TIME_ELAPSED because elapsed queries cannot nest, timestamps can be taken anywhere. Asking for a query's
+//result before the GPU has reached it would stall until it does, so each frame's queries live in one slot of a
+//ring and are only read frameSlots - 1 frames later, once they are known to be done. If a slot is still not done
+//when the ring comes back around, that frame goes unprofiled rather than waiting.
+//Resolved frames are also written to the trace file when one is open, on a "GPU" track.
+//Like the GL context, the profiler must only be used by the thread that has the context current.
+class GpuProfiler
+{
+public:
+    static const unsigned int frameSlots = 4;
+    static const unsigned int maxScopes = 32;
+
+    struct Scope
+    {
+        //Names are kept as pointers, they have to be string literals or otherwise outlive the profiler
+        const char* name;
+        unsigned int depth;
+        //Start relative to the frame's first scope, and duration
+        double startMs;
+        double ms;
+    };
+
+    //This creates the queries, returns false (and leaves the profiler off) if the driver has no timestamp counter
+    bool init();
+    void shutdown();
+
+    void beginFrame();
+    //This closes the frame and reads back every older frame whose queries are done, without waiting
+    void endFrame();
+    //Scopes nest and have to be closed in order within the frame
+    void begin(const char* name);
+    void end();
+
+    bool isEnabled() const { return enabled; }
+    //The scopes of the newest resolved frame in the order they were opened, a few frames behind the current one
+    const std::vector<Scope>& getResults() const { return results; }
+    //The frame the results are from, counting from 1, so callers can tell a new frame's results from the same ones again
+    uint64_t getResultFrame() const { return resultFrame; }
+    //Frames not profiled because their slot was still waiting on the GPU or they had too many scopes
+    unsigned int getDroppedFrames() const { return droppedFrames; }
+
+private:
+    struct PendingScope
+    {
+        const char* name;
+        unsigned int depth;
+        //Index of the begin query, the end query is the one after it
+        unsigned int query;
+    };
+
+    struct FrameSlot
+    {
+        unsigned int queries[maxScopes * 2];
+        std::vector<PendingScope> scopes;
+        unsigned int queryCount = 0;
+        //The query issued last, when it is done every query of the frame is
+        unsigned int lastQuery = 0;
+        bool pending = false;
+        uint64_t frame = 0;
+    };
+
+    void resolve(FrameSlot& slot);
+    //This lines the GPU clock up with the steady clock, so GPU events sit under the CPU work that issued them
+    void syncClocks();
+
+    FrameSlot slots[frameSlots];
+    uint64_t frame = 0;
+    FrameSlot* current = nullptr;
+    //Scopes still open in the current frame, as indices into its scopes
+    std::vector<unsigned int> open;
+    std::vector<Scope> results;
+    uint64_t resultFrame = 0;
+    unsigned int droppedFrames = 0;
+    bool enabled = false;
+    //The GPU timestamp and trace time taken together at the last sync
+    int64_t syncGpuNs = 0;
+    double syncTraceUs = 0.0;
+    unsigned int traceTrack = 0;
+};
@@ -0,0 +1,46 @@
+#include "Renderer/InstanceBatch.h"
+
+void InstanceBatch::begin(const float* matrix)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        viewProjection[i] = matrix[i];
+    }
+    clear();
+}
+
+void InstanceBatch::clear()
+{
+    for (Group& group : groups)
+    {
+        group.instances.clear();
+    }
+}
+
+InstanceBatch::Group& InstanceBatch::findGroup(const Mesh& mesh)
+{
+    auto found = groupLookup.find(mesh.geometry);
+    if (found != groupLookup.end())
+    {
+        //The mesh is copied every time in case the handle now belongs to a different mesh
+        Group& group = groups[found->second];
+        group.mesh = mesh;
+        return group;
+    }
+
+    groupLookup[mesh.geometry] = groups.size();
+    groups.push_back(Group());
+    groups.back().mesh = mesh;
+    return groups.back();
+}
+
+void InstanceBatch::submit(const Mesh& mesh, const InstanceData& instance)
+{
+    findGroup(mesh).instances.push_back(instance);
+}
+
+void InstanceBatch::submit(const Mesh& mesh, const InstanceData* instances, size_t count)
+{
+    std::vector<InstanceData>& target = findGroup(mesh).instances;
+    target.insert(target.end(), instances, instances + count);
+}
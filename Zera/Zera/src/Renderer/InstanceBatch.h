@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Renderer/Mesh.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+//Per instance data streamed next to a mesh, the transform is a column major 4x4 matrix
+struct InstanceData
+{
+    float transform[16];
+    float color[4];
+};
+
+//The instance batch records instances on the CPU and groups them by mesh as they are submitted, so however
+//the instances arrive each distinct mesh ends up as one instanced draw in the InstancedRenderer.
+class InstanceBatch
+{
+public:
+    struct Group
+    {
+        Mesh mesh;
+        std::vector<InstanceData> instances;
+    };
+
+    //This starts a new frame, viewProjection is a column major 4x4 matrix
+    void begin(const float* viewProjection);
+    //This queues one instance of the mesh, instances of the same mesh are merged into one group
+    void submit(const Mesh& mesh, const InstanceData& instance);
+    //This queues a whole array of instances of the mesh
+    void submit(const Mesh& mesh, const InstanceData* instances, size_t count);
+    //This drops every recorded instance but keeps the groups' storage for the next frame
+    void clear();
+
+    const std::vector<Group>& getGroups() const { return groups; }
+    const float* getViewProjection() const { return viewProjection; }
+
+private:
+    Group& findGroup(const Mesh& mesh);
+
+    //Groups are keyed by geometry handle since meshes share VAOs, keeping them in a vector keeps the draw order stable from frame to frame
+    std::unordered_map<unsigned int, size_t> groupLookup;
+    std::vector<Group> groups;
+    float viewProjection[16] = {};
+};
@@ -0,0 +1,135 @@
+#include "Renderer/InstancedRenderer.h"
+#include "Core/Profiler.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/StreamBuffer.h"
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/VertexLayout.h"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstring>
+
+//Per instance data as it sits in the stream, the mat4 is one attribute per column
+static constexpr VertexLayout instanceLayout = makeVertexLayout<InstanceData>(1,
+    vertexAttribute(InstanceTransformAttribute + 0, 4, GL_FLOAT, false, offsetof(InstanceData, transform) + 0 * 4 * sizeof(float)),
+    vertexAttribute(InstanceTransformAttribute + 1, 4, GL_FLOAT, false, offsetof(InstanceData, transform) + 1 * 4 * sizeof(float)),
+    vertexAttribute(InstanceTransformAttribute + 2, 4, GL_FLOAT, false, offsetof(InstanceData, transform) + 2 * 4 * sizeof(float)),
+    vertexAttribute(InstanceTransformAttribute + 3, 4, GL_FLOAT, false, offsetof(InstanceData, transform) + 3 * 4 * sizeof(float)),
+    VERTEX_ATTRIBUTE(InstanceData, color, InstanceColorAttribute, 4, GL_FLOAT, false));
+static_assert(instanceLayout.isValid(), "instanceLayout does not describe InstanceData");
+
+//Instanced vertex shader, the model matrix and color come from the per instance stream
+static const char* instancedVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 3) in mat4 aTransform;\n"
+"layout (location = 7) in vec4 aColor;\n"
+"out vec4 vColor;\n"
+"void main()\n"
+"{\n"
+"   vColor = aColor;\n"
+"   gl_Position = view.viewProjection * aTransform * vec4(aPos, 1.0);\n"
+"}\0";
+//Instanced fragment shader, just outputs the instance color
+static const char* instancedFragmentShaderSource = "#version 330 core\n"
+"in vec4 vColor;\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"   FragColor = vColor;\n"
+"}\n\0";
+
+bool InstancedRenderer::init(StreamBuffer& stream)
+{
+    program = shaderManager().submit("instanced", instancedVertexShaderSource, instancedFragmentShaderSource);
+    baseInstance = glCapabilities().baseInstance;
+    streamBuffer = stream.getBuffer();
+    return program != 0;
+}
+
+void InstancedRenderer::shutdown()
+{
+    preparedVertexArrays.clear();
+    rejectedVertexArrays.clear();
+    shaderManager().release(program);
+    program = 0;
+}
+
+bool InstancedRenderer::addMesh(const Mesh& mesh, const char* what)
+{
+    //Every mesh on a pool page shares its VAO, so the page is set up and checked for the first of them
+    if (preparedVertexArrays.count(mesh.VAO))
+    {
+        return true;
+    }
+    if (rejectedVertexArrays.count(mesh.VAO))
+    {
+        return false;
+    }
+
+    glState().bindVertexArray(mesh.VAO);
+    enableVertexLayout(instanceLayout);
+    //With base instance the attributes point at the start of the ring for good and each draw picks its offset
+    if (baseInstance)
+    {
+        glState().bindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+        pointVertexLayout(instanceLayout, 0);
+    }
+    bool valid = shaderManager().validateVertexInputs(program, mesh.VAO, what);
+    glState().bindVertexArray(0);
+    glState().bindBuffer(GL_ARRAY_BUFFER, 0);
+    (valid ? preparedVertexArrays : rejectedVertexArrays).insert(mesh.VAO);
+    return valid;
+}
+
+unsigned int InstancedRenderer::submit(const InstanceBatch& batch, StreamBuffer& stream, UniformBuffer& uniforms)
+{
+    ZERA_PROFILE_SCOPE("instances submit");
+    unsigned int drawCalls = 0;
+    for (const InstanceBatch::Group& group : batch.getGroups())
+    {
+        //Meshes that never passed addMesh would be drawn with whatever the VAO's instance attributes happen to be
+        if (group.instances.empty() || !preparedVertexArrays.count(group.mesh.VAO))
+        {
+            continue;
+        }
+        if (drawCalls == 0)
+        {
+            if (!shaderManager().prepare(program))
+            {
+                return 0;
+            }
+            glState().setDepthTest(false);
+            glState().setBlend(false);
+            glState().useProgram(program);
+            ViewConstants view;
+            memcpy(view.viewProjection, batch.getViewProjection(), sizeof(view.viewProjection));
+            uniforms.bind(ViewBinding, view);
+        }
+
+        size_t offset = stream.write(group.instances.data(), group.instances.size() * sizeof(InstanceData), sizeof(InstanceData));
+
+        glState().bindVertexArray(group.mesh.VAO);
+
+        GeometryRange range = getMeshRange(group.mesh);
+        const void* indexOffset = (void*)((size_t)range.firstIndex * sizeof(unsigned int));
+        if (baseInstance)
+        {
+            //The write was aligned to sizeof(InstanceData), so the offset is a whole number of instances
+            glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, group.mesh.indexCount, GL_UNSIGNED_INT, indexOffset,
+                (GLsizei)group.instances.size(), range.baseVertex, (GLuint)(offset / sizeof(InstanceData)));
+        }
+        else
+        {
+            //GL 3.3 has no base instance, so the instance attributes are re-pointed at this frame's offset in the ring
+            glState().bindBuffer(GL_ARRAY_BUFFER, stream.getBuffer());
+            pointVertexLayout(instanceLayout, offset);
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, group.mesh.indexCount, GL_UNSIGNED_INT, indexOffset,
+                (GLsizei)group.instances.size(), range.baseVertex);
+        }
+        drawCalls++;
+    }
+    return drawCalls;
+}
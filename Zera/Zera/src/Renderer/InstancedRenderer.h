@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Renderer/InstanceBatch.h"
+#include "Renderer/Mesh.h"
+
+#include <unordered_set>
+
+class StreamBuffer;
+class UniformBuffer;
+
+//The instanced renderer draws a recorded InstanceBatch with one glDrawElementsInstanced per mesh. Each mesh's
+//instances are written into the renderer's ring buffer and its VAO's per instance attributes (transform at
+//locations 3-6, color at 7, divisor 1) are pointed at them right before the draw. With GL_ARB_base_instance the
+//attributes are pointed at the ring once per VAO and each draw starts at its instances with a base instance instead.
+//Meshes are handed over with addMesh while loading, which is where their layouts meet the instanced shader.
+class InstancedRenderer
+{
+public:
+    bool init(StreamBuffer& stream);
+    void shutdown();
+
+    //This enables the instance attributes on the mesh's VAO and checks the VAO against the instanced shader,
+    //printing what is missing. Call it while loading, with the context current, for every mesh that will be
+    //instanced. Meshes that fail it, or never went through it, are skipped by submit instead of drawn.
+    bool addMesh(const Mesh& mesh, const char* what);
+    //This streams each mesh's instances and draws them, returns the number of draw calls
+    unsigned int submit(const InstanceBatch& batch, StreamBuffer& stream, UniformBuffer& uniforms);
+
+private:
+    //VAOs that passed addMesh, their instance attributes are enabled and given a divisor. These are geometry pool
+    //pages, which keep their VAOs until the pool shuts down after the renderer. Written while loading, only read
+    //by submit on the render thread.
+    std::unordered_set<unsigned int> preparedVertexArrays;
+    //VAOs that failed addMesh, so every mesh on a broken page is only reported once
+    std::unordered_set<unsigned int> rejectedVertexArrays;
+    unsigned int program = 0;
+    unsigned int streamBuffer = 0;
+    bool baseInstance = false;
+};
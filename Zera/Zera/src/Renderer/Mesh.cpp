@@ -0,0 +1,83 @@
+#include "Renderer/Mesh.h"
+#include "Renderer/VertexPacking.h"
+
+#include <vector>
+
+static MeshMemory meshMemory;
+
+static Mesh uploadMesh(const VertexLayout& layout, const void* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount)
+{
+    Mesh mesh;
+    mesh.geometry = geometryPool().allocate(layout, vertices, vertexCount, indices, indexCount);
+    mesh.VAO = geometryPool().getVertexArray(mesh.geometry);
+    mesh.indexCount = indexCount;
+    mesh.layout = &layout;
+
+    meshMemory.meshes++;
+    meshMemory.vertices += vertexCount;
+    meshMemory.vertexBytes += (size_t)vertexCount * layout.stride;
+    return mesh;
+}
+
+Mesh createMesh(const MeshData& data)
+{
+    //Bytes per vertex the same attributes would take as plain floats
+    size_t floatStride = 3 * sizeof(float);
+    floatStride += data.texCoords ? 2 * sizeof(float) : 0;
+    floatStride += data.normals ? 3 * sizeof(float) : 0;
+    floatStride += data.tangents ? 4 * sizeof(float) : 0;
+    floatStride += data.colors ? 4 * sizeof(float) : 0;
+    meshMemory.floatVertexBytes += floatStride * data.vertexCount;
+
+    //Nothing to pack, the positions go up as they are
+    if (!data.texCoords && !data.normals && !data.tangents && !data.colors)
+    {
+        return uploadMesh(positionLayout, data.positions, data.vertexCount, data.indices, data.indexCount);
+    }
+
+    static const float defaultNormal[3] = { 0.0f, 0.0f, 1.0f };
+    static const float defaultTangent[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+    std::vector<PackedVertex> vertices(data.vertexCount);
+    for (unsigned int i = 0; i < data.vertexCount; i++)
+    {
+        PackedVertex& vertex = vertices[i];
+        vertex.position[0] = data.positions[i * 3 + 0];
+        vertex.position[1] = data.positions[i * 3 + 1];
+        vertex.position[2] = data.positions[i * 3 + 2];
+        vertex.texCoord[0] = packHalf(data.texCoords ? data.texCoords[i * 2 + 0] : 0.0f);
+        vertex.texCoord[1] = packHalf(data.texCoords ? data.texCoords[i * 2 + 1] : 0.0f);
+        packOctahedral(data.normals ? data.normals + i * 3 : defaultNormal, vertex.normal);
+        vertex.tangent = packTangent(data.tangents ? data.tangents + i * 4 : defaultTangent);
+        for (int c = 0; c < 4; c++)
+        {
+            vertex.color[c] = packUnorm8(data.colors ? data.colors[i * 4 + c] : 1.0f);
+        }
+    }
+    return uploadMesh(packedLayout, vertices.data(), data.vertexCount, data.indices, data.indexCount);
+}
+
+Mesh createMesh(const float* positions, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount)
+{
+    MeshData data;
+    data.positions = positions;
+    data.vertexCount = vertexCount;
+    data.indices = indices;
+    data.indexCount = indexCount;
+    return createMesh(data);
+}
+
+void destroyMesh(Mesh& mesh)
+{
+    geometryPool().free(mesh.geometry);
+    mesh = Mesh();
+}
+
+GeometryRange getMeshRange(const Mesh& mesh)
+{
+    return geometryPool().getRange(mesh.geometry);
+}
+
+const MeshMemory& getMeshMemory()
+{
+    return meshMemory;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Renderer/GeometryPool.h"
+#include "Renderer/VertexLayout.h"
+
+#include <cstdint>
+
+//Position only meshes are plain X, Y, Z positions
+struct PositionVertex
+{
+    float position[3];
+};
+inline constexpr VertexLayout positionLayout = makeVertexLayout<PositionVertex>(0,
+    VERTEX_ATTRIBUTE(PositionVertex, position, PositionAttribute, 3, GL_FLOAT, false));
+static_assert(positionLayout.isValid(), "positionLayout does not describe PositionVertex");
+
+//Meshes with more than positions are packed at import. Positions stay full floats, everything else is stored
+//at the precision it needs: half float UVs, an octahedral snorm16 normal (decodeOctahedral in the shader),
+//a 2_10_10_10 tangent with the handedness in w and unorm8 colors. 28 bytes against 64 for the same data as floats.
+struct PackedVertex
+{
+    float position[3];
+    uint16_t texCoord[2];
+    int16_t normal[2];
+    uint32_t tangent;
+    uint8_t color[4];
+};
+inline constexpr VertexLayout packedLayout = makeVertexLayout<PackedVertex>(0,
+    VERTEX_ATTRIBUTE(PackedVertex, position, PositionAttribute, 3, GL_FLOAT, false),
+    VERTEX_ATTRIBUTE(PackedVertex, texCoord, TexCoordAttribute, 2, GL_HALF_FLOAT, false),
+    VERTEX_ATTRIBUTE(PackedVertex, normal, NormalAttribute, 2, GL_SHORT, true),
+    VERTEX_ATTRIBUTE(PackedVertex, tangent, TangentAttribute, 4, GL_INT_2_10_10_10_REV, true),
+    VERTEX_ATTRIBUTE(PackedVertex, color, ColorAttribute, 4, GL_UNSIGNED_BYTE, true));
+static_assert(packedLayout.isValid(), "packedLayout does not describe PackedVertex");
+
+//Mesh data as it is imported, one float array per attribute. Only positions are required, missing attributes
+//are filled with UV 0,0, normal +Z, tangent +X and white.
+struct MeshData
+{
+    const float* positions = nullptr;
+    //2 floats per vertex
+    const float* texCoords = nullptr;
+    //3 floats per vertex, unit length
+    const float* normals = nullptr;
+    //4 floats per vertex, xyz unit length and w the bitangent sign
+    const float* tangents = nullptr;
+    //4 floats per vertex, 0..1
+    const float* colors = nullptr;
+    unsigned int vertexCount = 0;
+    const unsigned int* indices = nullptr;
+    unsigned int indexCount = 0;
+};
+
+//A mesh is a handle to its geometry in the geometry pool plus the pool page's VAO, which it shares with every
+//other mesh of its layout on that page. Its first index and base vertex can move, draws get them from getMeshRange.
+struct Mesh
+{
+    unsigned int VAO = 0;
+    unsigned int geometry = 0;
+    unsigned int indexCount = 0;
+    const VertexLayout* layout = nullptr;
+};
+
+//Running totals of what meshes take on the GPU against what the same attributes would take as floats
+struct MeshMemory
+{
+    unsigned int meshes = 0;
+    unsigned int vertices = 0;
+    size_t vertexBytes = 0;
+    size_t floatVertexBytes = 0;
+};
+
+//This packs the data into the smallest layout that holds its attributes and uploads it into the geometry pool
+Mesh createMesh(const MeshData& data);
+//This uploads the positions and indices into the geometry pool
+Mesh createMesh(const float* positions, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount);
+void destroyMesh(Mesh& mesh);
+//Where the mesh's indices and vertices are in its page right now
+GeometryRange getMeshRange(const Mesh& mesh);
+const MeshMemory& getMeshMemory();
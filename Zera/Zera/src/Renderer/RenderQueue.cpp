@@ -0,0 +1,320 @@
+#include "Renderer/RenderQueue.h"
+#include "Core/Profiler.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/ShaderManager.h"
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstring>
+
+namespace SortKey
+{
+    uint32_t depthBits(float viewDepth)
+    {
+        if (!(viewDepth > 0.0f))
+        {
+            return 0;
+        }
+        uint32_t bits;
+        memcpy(&bits, &viewDepth, sizeof(bits));
+        return bits;
+    }
+
+    uint64_t opaque(unsigned int layer, unsigned int shader, unsigned int material, float viewDepth)
+    {
+        return ((uint64_t)(layer & 0xF) << 60)
+            | ((uint64_t)(shader & 0x7FF) << 48)
+            | ((uint64_t)(material & 0xFFFF) << 32)
+            | (uint64_t)depthBits(viewDepth);
+    }
+
+    uint64_t translucent(unsigned int layer, unsigned int shader, unsigned int material, float viewDepth)
+    {
+        //Inverting the depth makes the farthest draw sort first
+        return ((uint64_t)(layer & 0xF) << 60)
+            | ((uint64_t)1 << 59)
+            | ((uint64_t)(~depthBits(viewDepth)) << 27)
+            | ((uint64_t)(shader & 0x7FF) << 16)
+            | (uint64_t)(material & 0xFFFF);
+    }
+
+    bool isTranslucent(uint64_t key)
+    {
+        return (key >> 59) & 1;
+    }
+}
+
+void radixSort(SortItem* items, SortItem* scratch, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    //All eight histograms are built in one read over the keys
+    size_t histograms[8][256];
+    memset(histograms, 0, sizeof(histograms));
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t key = items[i].key;
+        for (int pass = 0; pass < 8; pass++)
+        {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    SortItem* source = items;
+    SortItem* destination = scratch;
+    for (int pass = 0; pass < 8; pass++)
+    {
+        size_t* histogram = histograms[pass];
+        //If every key has the same byte here the pass would not move anything
+        if (histogram[(source[0].key >> (pass * 8)) & 0xFF] == count)
+        {
+            continue;
+        }
+
+        //Turn the counts into starting offsets for each bucket
+        size_t offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++)
+        {
+            size_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            destination[histogram[(source[i].key >> (pass * 8)) & 0xFF]++] = source[i];
+        }
+
+        SortItem* swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    if (source != items)
+    {
+        memcpy(items, source, count * sizeof(SortItem));
+    }
+}
+
+void RenderQueue::clear()
+{
+    commands.clear();
+    constants.clear();
+    materials.clear();
+    order.clear();
+    static const float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    setViewProjection(identity);
+}
+
+void RenderQueue::setViewProjection(const float* viewProjection)
+{
+    memcpy(view.viewProjection, viewProjection, sizeof(view.viewProjection));
+}
+
+unsigned int RenderQueue::addMaterial(const MaterialConstants& material)
+{
+    materials.push_back(material);
+    return (unsigned int)materials.size() - 1;
+}
+
+void RenderQueue::push(const RenderCommand& command, const DrawConstants& drawConstants)
+{
+    RenderCommand copy = command;
+    copy.constants = (unsigned int)constants.size();
+    constants.push_back(drawConstants);
+    commands.push_back(copy);
+}
+
+void RenderQueue::sort()
+{
+    ZERA_PROFILE_SCOPE("queue sort");
+    auto start = std::chrono::steady_clock::now();
+
+    //Only the key/index pairs move around, the commands stay where they were pushed
+    size_t count = commands.size();
+    order.resize(count);
+    scratch.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        order[i].key = commands[i].sortKey;
+        order[i].index = (uint32_t)i;
+    }
+    if (count > 1)
+    {
+        radixSort(order.data(), scratch.data(), count);
+    }
+
+    stats.commands = (unsigned int)count;
+    stats.sortMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void RenderQueue::submit(UniformBuffer& uniforms, bool multiDraw, StreamBuffer* indirect)
+{
+    ZERA_PROFILE_SCOPE("queue submit");
+    auto start = std::chrono::steady_clock::now();
+    stats.drawCalls = 0;
+    stats.multiDraws = 0;
+    stats.indirect = false;
+    if (materials.empty())
+    {
+        materials.push_back({ { 1.0f, 1.0f, 1.0f, 1.0f } });
+    }
+
+    //Every material and every block of draws starts on the buffer's offset alignment so it can be bound on its own
+    size_t alignment = uniforms.getAlignment();
+    size_t materialStride = (sizeof(MaterialConstants) + alignment - 1) / alignment * alignment;
+    size_t blockBytes = drawsPerBlock * sizeof(DrawConstants);
+    size_t blockStride = (blockBytes + alignment - 1) / alignment * alignment;
+    size_t blockCount = (order.size() + drawsPerBlock - 1) / drawsPerBlock;
+
+    size_t materialOffset = 0;
+    char* mapped = (char*)uniforms.map(materials.size() * materialStride, materialOffset);
+    if (!mapped)
+    {
+        return;
+    }
+    for (size_t i = 0; i < materials.size(); i++)
+    {
+        memcpy(mapped + i * materialStride, &materials[i], sizeof(MaterialConstants));
+    }
+    uniforms.unmap();
+
+    //Draw constants are copied in sorted order, so draw i reads entry i % drawsPerBlock of block i / drawsPerBlock
+    size_t drawOffset = 0;
+    mapped = (char*)uniforms.map(blockCount * blockStride, drawOffset);
+    if (!mapped)
+    {
+        return;
+    }
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        const RenderCommand& command = commands[order[i].index];
+        memcpy(mapped + (i / drawsPerBlock) * blockStride + (i % drawsPerBlock) * sizeof(DrawConstants), &constants[command.constants], sizeof(DrawConstants));
+    }
+    uniforms.unmap();
+
+    uniforms.bind(ViewBinding, view);
+
+    //Every draw gets its indirect command in sorted order, so a run starting at draw i reads from entry i
+    size_t indirectOffset = 0;
+    if (multiDraw && indirect)
+    {
+        DrawElementsIndirectCommand* draws = (DrawElementsIndirectCommand*)indirect->map(order.size() * sizeof(DrawElementsIndirectCommand), sizeof(unsigned int), indirectOffset);
+        if (draws)
+        {
+            for (size_t i = 0; i < order.size(); i++)
+            {
+                const RenderCommand& command = commands[order[i].index];
+                draws[i] = { command.indexCount, 1, command.firstIndex, command.baseVertex, 0 };
+            }
+            indirect->unmap();
+            glState().bindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect->getBuffer());
+            stats.indirect = true;
+        }
+    }
+
+    //Without draw parameters every draw of a multi draw reads the same constants, so only draws whose constants
+    //are identical can share one
+    bool drawParameters = shaderManager().getStats().drawParameters;
+    unsigned int currentProgram = 0;
+    bool currentProgramUsable = false;
+    unsigned int currentMaterial = 0xFFFFFFFFu;
+    size_t currentBlock = (size_t)-1;
+    size_t i = 0;
+    while (i < order.size())
+    {
+        const RenderCommand& command = commands[order[i].index];
+
+        //Programs are resolved at their first draw, ones that failed to link are skipped
+        if (command.program != currentProgram)
+        {
+            currentProgram = command.program;
+            currentProgramUsable = shaderManager().prepare(command.program);
+        }
+        if (!currentProgramUsable)
+        {
+            i++;
+            continue;
+        }
+        //Opaque draws test and write depth, translucent ones blend over them without writing depth
+        bool translucent = SortKey::isTranslucent(command.sortKey);
+        glState().setDepthTest(true);
+        glState().depthMask(!translucent);
+        glState().setBlend(translucent);
+        if (translucent)
+        {
+            glState().blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        }
+
+        glState().useProgram(command.program);
+        glState().bindVertexArray(command.vertexArray);
+        glState().bindTexture(0, GL_TEXTURE_2D, command.texture);
+
+        unsigned int material = command.material < materials.size() ? command.material : 0;
+        if (material != currentMaterial)
+        {
+            uniforms.bindRange(MaterialBinding, materialOffset + material * materialStride, sizeof(MaterialConstants));
+            currentMaterial = material;
+        }
+        //Binding only changes every drawsPerBlock draws, in between the draw index is all that moves
+        size_t block = i / drawsPerBlock;
+        if (block != currentBlock)
+        {
+            uniforms.bindRange(DrawBinding, drawOffset + block * blockStride, blockBytes);
+            currentBlock = block;
+        }
+        glVertexAttribI1ui(drawIndexLocation, (unsigned int)(i % drawsPerBlock));
+
+        //The run takes every following draw with the same state, up to the end of the bound block
+        size_t end = i + 1;
+        if (multiDraw)
+        {
+            size_t blockEnd = (block + 1) * drawsPerBlock < order.size() ? (block + 1) * drawsPerBlock : order.size();
+            while (end < blockEnd)
+            {
+                const RenderCommand& next = commands[order[end].index];
+                unsigned int nextMaterial = next.material < materials.size() ? next.material : 0;
+                if (next.program != command.program || next.vertexArray != command.vertexArray || next.texture != command.texture ||
+                    nextMaterial != material || SortKey::isTranslucent(next.sortKey) != translucent ||
+                    (!drawParameters && memcmp(&constants[next.constants], &constants[command.constants], sizeof(DrawConstants)) != 0))
+                {
+                    break;
+                }
+                end++;
+            }
+        }
+
+        if (end - i == 1)
+        {
+            glDrawElementsBaseVertex(GL_TRIANGLES, command.indexCount, GL_UNSIGNED_INT, (void*)((size_t)command.firstIndex * sizeof(unsigned int)), command.baseVertex);
+        }
+        else if (stats.indirect)
+        {
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)(indirectOffset + i * sizeof(DrawElementsIndirectCommand)), (GLsizei)(end - i), 0);
+            stats.multiDraws++;
+        }
+        else
+        {
+            runCounts.clear();
+            runOffsets.clear();
+            runBaseVertices.clear();
+            for (size_t j = i; j < end; j++)
+            {
+                const RenderCommand& run = commands[order[j].index];
+                runCounts.push_back((GLsizei)run.indexCount);
+                runOffsets.push_back((const void*)((size_t)run.firstIndex * sizeof(unsigned int)));
+                runBaseVertices.push_back(run.baseVertex);
+            }
+            glMultiDrawElementsBaseVertex(GL_TRIANGLES, runCounts.data(), GL_UNSIGNED_INT, runOffsets.data(), (GLsizei)runCounts.size(), runBaseVertices.data());
+            stats.multiDraws++;
+        }
+        stats.drawCalls++;
+        i = end;
+    }
+
+    stats.submitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
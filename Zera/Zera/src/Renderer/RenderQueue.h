@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Renderer/StreamBuffer.h"
+#include "Renderer/UniformBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//A single draw in the queue. Commands are small POD structs, everything bigger than a handle
+//(the per draw and per material constants) lives in side arrays that the command indexes.
+struct RenderCommand
+{
+    uint64_t sortKey;
+    unsigned int program;
+    unsigned int vertexArray;
+    unsigned int texture;
+    unsigned int indexCount;
+    unsigned int firstIndex;
+    //Added to every index, meshes from the geometry pool share their page's buffers and start wherever they were put
+    int baseVertex;
+    //Index returned by RenderQueue::addMaterial, 0 is plain white when no materials were added
+    unsigned int material;
+    unsigned int constants;
+};
+
+//One draw of glMultiDrawElementsIndirect, laid out the way GL reads it from the indirect buffer
+struct DrawElementsIndirectCommand
+{
+    unsigned int count;
+    unsigned int instanceCount;
+    unsigned int firstIndex;
+    int baseVertex;
+    unsigned int baseInstance;
+};
+
+//Sort keys pack everything that decides draw order into 64 bits so one integer sort orders the whole frame.
+//From the top bit down:
+//  opaque:      layer(4) | 0 | shader(11) | material(16) | depth(32)          state first, then front to back
+//  translucent: layer(4) | 1 | inverted depth(32) | shader(11) | material(16) back to front, state last
+namespace SortKey
+{
+    const unsigned int layerBits = 4;
+    const unsigned int shaderBits = 11;
+    const unsigned int materialBits = 16;
+
+    //Depth is a non negative view distance, positive float bits sort the same way as the floats do
+    uint32_t depthBits(float viewDepth);
+    uint64_t opaque(unsigned int layer, unsigned int shader, unsigned int material, float viewDepth);
+    uint64_t translucent(unsigned int layer, unsigned int shader, unsigned int material, float viewDepth);
+    bool isTranslucent(uint64_t key);
+}
+
+//This sorts items by key with an LSD radix sort, 8 bits per pass. Passes where every key has the same
+//byte are skipped, so keys that only use a few bits cost only a few passes. scratch must hold count items.
+struct SortItem
+{
+    uint64_t key;
+    uint32_t index;
+};
+void radixSort(SortItem* items, SortItem* scratch, size_t count);
+
+//Systems push commands into the queue during the frame, the renderer sorts them by key and submits them
+//in that order through the state cache so consecutive draws with the same state do not rebind anything.
+//Constants go through the uniform buffer: the view and materials are written once per frame, and the draw
+//constants are laid out in sorted order so one range bind covers drawsPerBlock consecutive draws. Consecutive
+//draws that share all their state and block can go out as one glMultiDrawElementsBaseVertex, geometry pool meshes
+//of one layout share a VAO so whole runs of different meshes qualify. When the driver has multi draw indirect the
+//runs are written into an indirect buffer instead and go out as glMultiDrawElementsIndirect, so the driver reads
+//the counts and offsets from GPU memory rather than copying our arrays on every call.
+class RenderQueue
+{
+public:
+    struct Stats
+    {
+        unsigned int commands = 0;
+        //GL draw calls issued, and how many of them were multi draws covering several commands
+        unsigned int drawCalls = 0;
+        unsigned int multiDraws = 0;
+        //Whether the multi draws were indirect
+        bool indirect = false;
+        double sortMs = 0.0;
+        double submitMs = 0.0;
+    };
+
+    //This drops the frame's commands and materials and resets the view to identity
+    void clear();
+    //The view projection every command in the queue is drawn with, a column major 4x4 matrix
+    void setViewProjection(const float* viewProjection);
+    //This adds a material for the frame and returns the index commands refer to it by
+    unsigned int addMaterial(const MaterialConstants& material);
+    //This copies the command in and stores its constants, the command's constants field is filled in here
+    void push(const RenderCommand& command, const DrawConstants& constants);
+    //This radix sorts the commands by key
+    void sort();
+    //This streams the constants and issues every command in sorted order. With multiDraw, runs of consecutive
+    //commands with the same program, VAO, texture, material and blending go out as one multi draw. If indirect is
+    //not null the draws are written into it and runs use glMultiDrawElementsIndirect.
+    void submit(UniformBuffer& uniforms, bool multiDraw, StreamBuffer* indirect);
+
+    size_t size() const { return commands.size(); }
+    const Stats& getStats() const { return stats; }
+
+private:
+    std::vector<RenderCommand> commands;
+    std::vector<DrawConstants> constants;
+    std::vector<MaterialConstants> materials;
+    ViewConstants view = { { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } };
+    std::vector<SortItem> order;
+    std::vector<SortItem> scratch;
+    //The current run's arrays for glMultiDrawElementsBaseVertex, kept to reuse their storage
+    std::vector<int> runCounts;
+    std::vector<const void*> runOffsets;
+    std::vector<int> runBaseVertices;
+    Stats stats;
+};
@@ -0,0 +1,86 @@
+#include "Renderer/RenderTarget.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+
+#include <glad/glad.h>
+
+#include <iostream>
+
+bool createRenderTarget(RenderTarget& target, int width, int height)
+{
+    target.width = width;
+    target.height = height;
+    GLenum status;
+    //With direct state access nothing gets bound, so the cached framebuffer and texture bindings stay valid
+    if (glCapabilities().directStateAccess)
+    {
+        glCreateTextures(GL_TEXTURE_2D, 1, &target.colorTexture);
+        glTextureParameteri(target.colorTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(target.colorTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(target.colorTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(target.colorTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureStorage2D(target.colorTexture, 1, GL_RGBA8, width, height);
+        glCreateRenderbuffers(1, &target.depthBuffer);
+        glNamedRenderbufferStorage(target.depthBuffer, GL_DEPTH_COMPONENT24, width, height);
+        glCreateFramebuffers(1, &target.framebuffer);
+        glNamedFramebufferTexture(target.framebuffer, GL_COLOR_ATTACHMENT0, target.colorTexture, 0);
+        glNamedFramebufferRenderbuffer(target.framebuffer, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, target.depthBuffer);
+        status = glCheckNamedFramebufferStatus(target.framebuffer, GL_FRAMEBUFFER);
+    }
+    else
+    {
+        glGenTextures(1, &target.colorTexture);
+        glState().bindTexture(0, GL_TEXTURE_2D, target.colorTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        if (glCapabilities().textureStorage)
+        {
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+        }
+        else
+        {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
+        glState().bindTexture(0, GL_TEXTURE_2D, 0);
+
+        //The renderbuffer binding is only used here, so it is not worth a slot in the state cache
+        glGenRenderbuffers(1, &target.depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, target.depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &target.framebuffer);
+        glState().bindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.colorTexture, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, target.depthBuffer);
+        status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glState().bindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cout << "ERROR::RENDER_TARGET::INCOMPLETE " << width << "x" << height << " status 0x" << std::hex << status << std::dec << std::endl;
+        destroyRenderTarget(target);
+        return false;
+    }
+    return true;
+}
+
+void destroyRenderTarget(RenderTarget& target)
+{
+    if (target.framebuffer)
+    {
+        glState().deleteFramebuffer(target.framebuffer);
+    }
+    if (target.colorTexture)
+    {
+        glState().deleteTexture(target.colorTexture);
+    }
+    if (target.depthBuffer)
+    {
+        glDeleteRenderbuffers(1, &target.depthBuffer);
+    }
+    target = RenderTarget();
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+//An offscreen framebuffer with an RGBA8 color texture and a 24 bit depth buffer. The color is a texture rather
+//than a renderbuffer so later passes can sample it as well as blit from it.
+struct RenderTarget
+{
+    unsigned int framebuffer = 0;
+    unsigned int colorTexture = 0;
+    unsigned int depthBuffer = 0;
+    int width = 0;
+    int height = 0;
+};
+
+//This creates the target's framebuffer and attachments at the given size, returns false if the driver rejects it
+bool createRenderTarget(RenderTarget& target, int width, int height);
+//This deletes the target's GL objects and zeroes it, it is fine to call on a target that was never created
+void destroyRenderTarget(RenderTarget& target);
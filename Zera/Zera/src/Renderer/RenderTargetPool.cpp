@@ -0,0 +1,79 @@
+#include "Renderer/RenderTargetPool.h"
+
+size_t RenderTargetPool::targetBytes(const RenderTarget& target)
+{
+    //RGBA8 color and a 24 bit depth buffer, which drivers store in 4 bytes
+    return (size_t)target.width * target.height * 8;
+}
+
+RenderTarget* RenderTargetPool::acquire(int width, int height)
+{
+    int bucketWidth = bucket(width);
+    int bucketHeight = bucket(height);
+    for (std::unique_ptr<Entry>& entry : entries)
+    {
+        if (!entry->inUse && entry->target.width == bucketWidth && entry->target.height == bucketHeight)
+        {
+            entry->inUse = true;
+            entry->idleFrames = 0;
+            stats.reused++;
+            return &entry->target;
+        }
+    }
+
+    std::unique_ptr<Entry> entry(new Entry());
+    if (!createRenderTarget(entry->target, bucketWidth, bucketHeight))
+    {
+        return nullptr;
+    }
+    entry->inUse = true;
+    stats.created++;
+    stats.alive++;
+    stats.bytes += targetBytes(entry->target);
+    entries.push_back(std::move(entry));
+    return &entries.back()->target;
+}
+
+void RenderTargetPool::release(RenderTarget* target)
+{
+    for (std::unique_ptr<Entry>& entry : entries)
+    {
+        if (&entry->target == target)
+        {
+            entry->inUse = false;
+            entry->idleFrames = 0;
+            return;
+        }
+    }
+}
+
+void RenderTargetPool::endFrame()
+{
+    for (size_t i = 0; i < entries.size();)
+    {
+        Entry& entry = *entries[i];
+        if (entry.inUse || ++entry.idleFrames < maxIdleFrames)
+        {
+            i++;
+            continue;
+        }
+        stats.freed++;
+        stats.alive--;
+        stats.bytes -= targetBytes(entry.target);
+        destroyRenderTarget(entry.target);
+        entries[i] = std::move(entries.back());
+        entries.pop_back();
+    }
+}
+
+void RenderTargetPool::shutdown()
+{
+    for (std::unique_ptr<Entry>& entry : entries)
+    {
+        stats.freed++;
+        destroyRenderTarget(entry->target);
+    }
+    entries.clear();
+    stats.alive = 0;
+    stats.bytes = 0;
+}
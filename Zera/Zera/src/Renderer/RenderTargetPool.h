@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Renderer/RenderTarget.h"
+
+#include <memory>
+#include <vector>
+
+//The render target pool hands out render targets with their sizes rounded up to whole buckets, so a window that
+//grows or shrinks by a few pixels keeps using the target it has. Released targets stay allocated for a while in
+//case the same size comes back, which it tends to when a window is dragged back and forth, and are freed once
+//they have gone unused for maxIdleFrames.
+class RenderTargetPool
+{
+public:
+    static const int bucketSize = 128;
+    static const unsigned int maxIdleFrames = 120;
+
+    struct Stats
+    {
+        unsigned int created = 0;
+        unsigned int reused = 0;
+        unsigned int freed = 0;
+        //Targets alive right now, in use or idle, and the bytes their color and depth take
+        unsigned int alive = 0;
+        size_t bytes = 0;
+    };
+
+    //This rounds a size up to the bucket it is allocated at
+    static int bucket(int size) { return (size + bucketSize - 1) / bucketSize * bucketSize; }
+
+    //This returns an unused target of the bucket the size falls in, creating one if there is none, or null if
+    //the driver rejects the size
+    RenderTarget* acquire(int width, int height);
+    //This gives a target back to the pool, the GL objects stay alive until it has sat idle long enough
+    void release(RenderTarget* target);
+    //Call once a frame, this ages the idle targets and frees the ones that are too old
+    void endFrame();
+    void shutdown();
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Entry
+    {
+        RenderTarget target;
+        bool inUse = false;
+        unsigned int idleFrames = 0;
+    };
+
+    static size_t targetBytes(const RenderTarget& target);
+
+    //Targets are handed out by pointer, so entries are allocated one by one and never move
+    std::vector<std::unique_ptr<Entry>> entries;
+    Stats stats;
+};
@@ -0,0 +1,160 @@
+#include "Renderer/RenderThread.h"
+#include "Core/Profiler.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/Renderer.h"
+
+#include <glad/glad.h>
+
+#include <chrono>
+
+//This waits until condition() is true, spinning briefly, then yielding, then sleeping in short steps so an
+//idle thread does not burn a whole core. Returns how long it waited in milliseconds.
+template <typename Condition>
+static double waitUntil(Condition condition)
+{
+    if (condition())
+    {
+        return 0.0;
+    }
+    ZERA_PROFILE_SCOPE("wait");
+    auto start = std::chrono::steady_clock::now();
+    for (int attempt = 0; !condition(); attempt++)
+    {
+        if (attempt < 1000)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool RenderThread::start(const GLContext& targetContext, Renderer* targetRenderer, bool useThread, bool noWindow)
+{
+    context = targetContext;
+    renderer = targetRenderer;
+    threaded = useThread;
+    headless = noWindow;
+    recordingFrame = 0;
+    submittedFrames.store(0);
+    executedFrames.store(0);
+    if (!threaded)
+    {
+        return true;
+    }
+
+    //A context can only be current on one thread, so the main thread lets go of it before the render thread takes it
+    releaseContext(context);
+    running.store(true);
+    thread = std::thread(&RenderThread::run, this);
+    return true;
+}
+
+void RenderThread::stop()
+{
+    if (threaded)
+    {
+        running.store(false, std::memory_order_release);
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+        makeContextCurrent(context);
+        //The render thread's binds are not known to be current for whoever uses the context next
+        glState().reset();
+        threaded = false;
+    }
+    //The last headless frames' fences are never waited on
+    for (GLsync& fence : presentFences)
+    {
+        if (fence)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+void RenderThread::present(uint64_t frame)
+{
+    if (!headless)
+    {
+        ZERA_PROFILE_SCOPE("swap buffers");
+        swapContextBuffers(context);
+        return;
+    }
+    //The fence in this slot is from two frames back, the same distance a double buffered swap chain allows
+    ZERA_PROFILE_SCOPE("headless present");
+    GLsync& fence = presentFences[frame & 1];
+    if (fence)
+    {
+        glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+}
+
+CommandBuffer& RenderThread::beginFrame()
+{
+    //Frame N reuses the buffer of frame N-2, so frame N-2 (and everything before it) has to be executed first
+    uint64_t frame = recordingFrame;
+    if (threaded)
+    {
+        mainWaitMs = waitUntil([this, frame]() { return executedFrames.load(std::memory_order_acquire) + 1 >= frame; });
+    }
+
+    CommandBuffer& buffer = buffers[frame & 1];
+    if (frame >= 2)
+    {
+        lastStats = buffer.stats;
+        lastRenderWaitMs = renderWaitMs[frame & 1];
+    }
+    buffer.clear();
+    return buffer;
+}
+
+void RenderThread::endFrame()
+{
+    CommandBuffer& buffer = buffers[recordingFrame & 1];
+    recordingFrame++;
+    if (!threaded)
+    {
+        renderer->execute(buffer);
+        present(recordingFrame);
+        lastStats = buffer.stats;
+        return;
+    }
+    submittedFrames.store(recordingFrame, std::memory_order_release);
+}
+
+void RenderThread::run()
+{
+    profilerSetThreadName("Render");
+    makeContextCurrent(context);
+    glState().reset();
+
+    uint64_t frame = 0;
+    while (true)
+    {
+        //Everything the main thread submitted gets executed before the thread exits
+        double waited = waitUntil([this, frame]() { return submittedFrames.load(std::memory_order_acquire) > frame || !running.load(std::memory_order_acquire); });
+        if (submittedFrames.load(std::memory_order_acquire) <= frame)
+        {
+            break;
+        }
+
+        CommandBuffer& buffer = buffers[frame & 1];
+        renderer->execute(buffer);
+        present(frame);
+
+        renderWaitMs[frame & 1] = waited;
+        frame++;
+        executedFrames.store(frame, std::memory_order_release);
+    }
+
+    releaseContext(context);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Core/GLContext.h"
+#include "Renderer/CommandBuffer.h"
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+class Renderer;
+
+//The render thread owns the GL context and executes frame N while the main thread records frame N+1.
+//There are two command buffers, handed back and forth through two frame counters (no locks): the main
+//thread only waits when it is about to record into the buffer the render thread is still executing.
+//Started without threading it runs the same frame flow inline on the calling thread, which is handy for debugging.
+//Headless it never swaps, the window is not shown, and a fence per frame stands in for the swap chain so the
+//CPU cannot run more than two frames ahead of the GPU.
+class RenderThread
+{
+public:
+    //This gives the context to the render thread (or keeps it on this thread if threaded is false)
+    bool start(const GLContext& context, Renderer* renderer, bool threaded, bool headless);
+    //This finishes every submitted frame, stops the thread and makes the context current on the calling thread again
+    void stop();
+
+    //This returns the command buffer to record the next frame into, cleared and ready
+    CommandBuffer& beginFrame();
+    //This publishes the recorded frame to the render thread (or executes and presents it inline)
+    void endFrame();
+
+    bool isThreaded() const { return threaded; }
+    //Stats of the newest frame the renderer has finished with
+    const RenderStats& getLastStats() const { return lastStats; }
+    //How long the main thread waited for a free command buffer in the last beginFrame
+    double getMainWaitMs() const { return mainWaitMs; }
+    //How long the render thread sat idle waiting for its last frame, only read it on the main thread after beginFrame
+    double getRenderWaitMs() const { return lastRenderWaitMs; }
+
+private:
+    void run();
+    //This swaps the window's buffers, or headless fences the frame and waits for the one two frames back
+    void present(uint64_t frame);
+
+    GLContext context;
+    Renderer* renderer = nullptr;
+    bool threaded = false;
+    bool headless = false;
+    std::thread thread;
+    //Headless only, the fence of each of the last two frames, touched only by the thread that presents
+    GLsync presentFences[2] = {};
+
+    CommandBuffer buffers[2];
+    //Frames published by the main thread and frames fully executed by the render thread
+    std::atomic<uint64_t> submittedFrames{ 0 };
+    std::atomic<uint64_t> executedFrames{ 0 };
+    std::atomic<bool> running{ false };
+    //Written by the render thread before it bumps executedFrames, so it is safe to read after waiting on it
+    double renderWaitMs[2] = {};
+
+    //Main thread only
+    uint64_t recordingFrame = 0;
+    RenderStats lastStats;
+    double mainWaitMs = 0.0;
+    double lastRenderWaitMs = 0.0;
+};
@@ -0,0 +1,198 @@
+#include "Renderer/Renderer.h"
+#include "Core/Profiler.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+bool Renderer::init()
+{
+    //Running without GPU timings is fine, so a driver without timestamps does not fail init
+    gpuProfiler.init();
+    if (glCapabilities().multiDrawIndirect && !indirectStream.init(GL_DRAW_INDIRECT_BUFFER, indirectStreamSize))
+    {
+        return false;
+    }
+    return vertexStream.init(GL_ARRAY_BUFFER, vertexStreamSize) && uniformBuffer.init(uniformBufferSize) && instancedRenderer.init(vertexStream) &&
+        spriteRenderer.init(vertexStream);
+}
+
+void Renderer::shutdown()
+{
+    gpuProfiler.shutdown();
+    sceneTarget = nullptr;
+    outputTarget = nullptr;
+    targetPool.shutdown();
+    spriteRenderer.shutdown();
+    instancedRenderer.shutdown();
+    uniformBuffer.shutdown();
+    vertexStream.shutdown();
+    if (indirectStream.getBuffer())
+    {
+        indirectStream.shutdown();
+    }
+}
+
+void Renderer::execute(CommandBuffer& buffer)
+{
+    ZERA_PROFILE_SCOPE("execute");
+    auto start = std::chrono::steady_clock::now();
+    glState().resetStats();
+    gpuProfiler.beginFrame();
+    gpuProfiler.begin("frame");
+
+    //Headless frames go into the output target wherever the window's framebuffer would be used. It only changes
+    //size when a headless run is started at a different size, so it skips the resize coordinator.
+    unsigned int outputFramebuffer = 0;
+    if (offscreenOutput)
+    {
+        if (!outputTarget || outputTarget->width != RenderTargetPool::bucket(buffer.width) || outputTarget->height != RenderTargetPool::bucket(buffer.height))
+        {
+            if (outputTarget)
+            {
+                targetPool.release(outputTarget);
+            }
+            outputTarget = targetPool.acquire(buffer.width, buffer.height);
+        }
+        outputFramebuffer = outputTarget ? outputTarget->framebuffer : 0;
+    }
+
+    //With dynamic resolution the scene goes into the top left corner of the scene target, which comes from the
+    //pool rounded up to a whole bucket. Changing the scale never reallocates it, and window resizes only do once
+    //the resize coordinator says the size has settled.
+    int renderWidth = buffer.width;
+    int renderHeight = buffer.height;
+    float renderScale = 1.0f;
+    bool scaled = resolutionScaler.isEnabled();
+    if (scaled)
+    {
+        if (gpuProfiler.getResultFrame() != scaledGpuFrame)
+        {
+            scaledGpuFrame = gpuProfiler.getResultFrame();
+            resolutionScaler.addSample(gpuProfiler.getResults().empty() ? 0.0 : gpuProfiler.getResults()[0].ms);
+        }
+        int targetWidth = std::max(1, (int)std::ceil(buffer.width * resolutionScaler.getMaxScale()));
+        int targetHeight = std::max(1, (int)std::ceil(buffer.height * resolutionScaler.getMaxScale()));
+        bool targetMatches = sceneTarget && sceneTarget->width == RenderTargetPool::bucket(targetWidth) &&
+            sceneTarget->height == RenderTargetPool::bucket(targetHeight);
+        if (resizeCoordinator.update(buffer.width, buffer.height, targetMatches) || !sceneTarget)
+        {
+            RenderTarget* target = targetPool.acquire(targetWidth, targetHeight);
+            if (target)
+            {
+                if (sceneTarget)
+                {
+                    targetPool.release(sceneTarget);
+                }
+                sceneTarget = target;
+            }
+            //Without a target there is nothing to scale into, so the rest of the run renders at full resolution
+            else if (!sceneTarget)
+            {
+                resolutionScaler.configure(0.0, 1.0f, 1.0f);
+                scaled = false;
+            }
+        }
+    }
+    if (scaled)
+    {
+        //While a resize waits for its target the scene is drawn at whatever scale still fits in the old one, the
+        //upscale stretches it over the new window size either way
+        float scale = std::min(resolutionScaler.getScale(), std::min((float)sceneTarget->width / buffer.width, (float)sceneTarget->height / buffer.height));
+        renderScale = scale;
+        renderWidth = std::min(sceneTarget->width, std::max(1, (int)(buffer.width * scale + 0.5f)));
+        renderHeight = std::min(sceneTarget->height, std::max(1, (int)(buffer.height * scale + 0.5f)));
+        glState().bindFramebuffer(GL_FRAMEBUFFER, sceneTarget->framebuffer);
+    }
+    else
+    {
+        glState().bindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+    }
+
+    gpuProfiler.begin("clear");
+    glState().viewport(0, 0, renderWidth, renderHeight);
+    glClearColor(buffer.clearColor[0], buffer.clearColor[1], buffer.clearColor[2], buffer.clearColor[3]);
+    //Depth writes have to be on for the depth clear to do anything
+    glState().depthMask(true);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    gpuProfiler.end();
+
+    //The frame block stays bound for the whole frame, each draw path binds its own view block
+    FrameConstants frame;
+    frame.time = buffer.time;
+    frame.deltaTime = buffer.deltaTime;
+    frame.resolution[0] = (float)renderWidth;
+    frame.resolution[1] = (float)renderHeight;
+    uniformBuffer.bind(FrameBinding, frame);
+
+    RenderStats& stats = buffer.stats;
+    stats = RenderStats();
+    if (buffer.queue.size() > 0)
+    {
+        gpuProfiler.begin("queue");
+        buffer.queue.sort();
+        buffer.queue.submit(uniformBuffer, multiDraw, indirectStream.getBuffer() ? &indirectStream : nullptr);
+        stats.drawCalls += buffer.queue.getStats().drawCalls;
+        stats.multiDraws = buffer.queue.getStats().multiDraws;
+        stats.sortMs = buffer.queue.getStats().sortMs;
+        gpuProfiler.end();
+    }
+    gpuProfiler.begin("instances");
+    stats.drawCalls += instancedRenderer.submit(buffer.instances, vertexStream, uniformBuffer);
+    gpuProfiler.end();
+    gpuProfiler.begin("sprites");
+    stats.drawCalls += spriteRenderer.submit(buffer.sprites, vertexStream, uniformBuffer);
+    gpuProfiler.end();
+    if (scaled)
+    {
+        //A linear blit is the cheapest upscale there is, one bilinear tap per window pixel
+        gpuProfiler.begin("upscale");
+        if (glCapabilities().directStateAccess)
+        {
+            glBlitNamedFramebuffer(sceneTarget->framebuffer, outputFramebuffer, 0, 0, renderWidth, renderHeight, 0, 0, buffer.width, buffer.height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        }
+        else
+        {
+            glState().bindFramebuffer(GL_READ_FRAMEBUFFER, sceneTarget->framebuffer);
+            glState().bindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFramebuffer);
+            glBlitFramebuffer(0, 0, renderWidth, renderHeight, 0, 0, buffer.width, buffer.height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        }
+        glState().bindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+        gpuProfiler.end();
+    }
+    targetPool.endFrame();
+    //This fences the frame's streamed data so the rings know when it can be overwritten again
+    vertexStream.endFrame();
+    uniformBuffer.endFrame();
+    if (indirectStream.getBuffer())
+    {
+        indirectStream.endFrame();
+    }
+    gpuProfiler.end();
+    gpuProfiler.endFrame();
+
+    stats.renderWidth = renderWidth;
+    stats.renderHeight = renderHeight;
+    stats.renderScale = renderScale;
+    stats.streamBytes = vertexStream.getStats().frameBytes;
+    stats.streamCapacity = vertexStream.getStats().capacity;
+    stats.streamWaitMs = vertexStream.getStats().waitMs;
+    for (const GpuProfiler::Scope& scope : gpuProfiler.getResults())
+    {
+        if (scope.depth == 0)
+        {
+            stats.gpuFrameMs = scope.ms;
+        }
+        else if (stats.gpuPassCount < RenderStats::maxGpuPasses)
+        {
+            stats.gpuPasses[stats.gpuPassCount++] = { scope.name, scope.depth, scope.ms };
+        }
+    }
+    stats.stateCalls = glState().getStats().issued;
+    stats.stateCallsSkipped = glState().getStats().skipped;
+    stats.executeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GpuProfiler.h"
+#include "Renderer/InstancedRenderer.h"
+#include "Renderer/RenderTargetPool.h"
+#include "Renderer/ResizeCoordinator.h"
+#include "Renderer/ResolutionScaler.h"
+#include "Renderer/SpriteRenderer.h"
+#include "Renderer/StreamBuffer.h"
+#include "Renderer/UniformBuffer.h"
+
+//The renderer owns the GL side of every draw path and executes recorded command buffers. It must only be
+//used on the thread that currently has the GL context.
+class Renderer
+{
+public:
+    //Size of the ring that per frame vertex and instance data is streamed through, enough for about three
+    //frames of the sprite stress scene in flight
+    static const size_t vertexStreamSize = 32 * 1024 * 1024;
+    //Size of the constant ring, the queue stress scene writes about 8MB of draw constants a frame
+    static const size_t uniformBufferSize = 32 * 1024 * 1024;
+    //Size of the ring the queue's indirect draws go through when multi draw indirect is supported, 20 bytes a draw
+    static const size_t indirectStreamSize = 8 * 1024 * 1024;
+
+    bool init();
+    void shutdown();
+
+    //This clears the frame, then sorts and submits the queue, the instances and finally the sprites on top. Each
+    //pass is a GPU profiler scope. With dynamic resolution on the passes draw into the scene target, which is then
+    //stretched over the window.
+    void execute(CommandBuffer& buffer);
+
+    InstancedRenderer& getInstancedRenderer() { return instancedRenderer; }
+    //Whether the render queue merges runs of draws with the same state into multi draws, on by default
+    void setMultiDraw(bool enabled) { multiDraw = enabled; }
+    //This renders the scene at between minScale and maxScale of the window's resolution, as much as keeps the GPU
+    //frame time under budgetMs. A budget of 0 (the default) renders straight to the window at full resolution.
+    void setDynamicResolution(double budgetMs, float minScale, float maxScale) { resolutionScaler.configure(budgetMs, minScale, maxScale); }
+
+    //This draws frames into an offscreen target the size of the frame instead of the window's framebuffer, for
+    //headless runs where the window is never shown
+    void setOffscreenOutput(bool enabled) { offscreenOutput = enabled; }
+
+    //The pool and resize stats stay readable after shutdown, for the exit report
+    const RenderTargetPool::Stats& getTargetPoolStats() const { return targetPool.getStats(); }
+    const ResizeCoordinator::Stats& getResizeStats() const { return resizeCoordinator.getStats(); }
+
+private:
+    StreamBuffer vertexStream;
+    //Only created when the driver has multi draw indirect
+    StreamBuffer indirectStream;
+    UniformBuffer uniformBuffer;
+    InstancedRenderer instancedRenderer;
+    SpriteRenderer spriteRenderer;
+    //Times the frame and each pass on the GPU
+    GpuProfiler gpuProfiler;
+    bool multiDraw = true;
+    //Every offscreen target comes from the pool, and the coordinator decides when they follow the window size
+    RenderTargetPool targetPool;
+    ResizeCoordinator resizeCoordinator;
+    //The target the scene is rendered into with dynamic resolution, sized for the largest scale, null until the first frame
+    RenderTarget* sceneTarget = nullptr;
+    //What headless frames end up in, the stand in for the window's framebuffer
+    bool offscreenOutput = false;
+    RenderTarget* outputTarget = nullptr;
+    ResolutionScaler resolutionScaler;
+    //The GPU profiler frame last fed to the scaler
+    uint64_t scaledGpuFrame = 0;
+};
@@ -0,0 +1,31 @@
+#include "Renderer/ResizeCoordinator.h"
+
+constexpr std::chrono::milliseconds ResizeCoordinator::settleTime;
+
+bool ResizeCoordinator::update(int newWidth, int newHeight, bool targetsMatch)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (newWidth != width || newHeight != height)
+    {
+        //The very first size has nothing to settle from
+        bool first = width == 0 && height == 0;
+        if (!first)
+        {
+            stats.resizes++;
+        }
+        changed = first ? now - settleTime : now;
+        width = newWidth;
+        height = newHeight;
+    }
+    if (targetsMatch)
+    {
+        return false;
+    }
+    if (now - changed < settleTime)
+    {
+        stats.deferredFrames++;
+        return false;
+    }
+    stats.reallocations++;
+    return true;
+}
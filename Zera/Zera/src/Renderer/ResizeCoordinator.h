@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+
+//The resize coordinator decides when the render targets follow a window resize. Dragging a window edge changes
+//the size every few milliseconds, and reallocating targets for each of those sizes would churn through GPU memory
+//and hitch every frame. The coordinator only gives the go ahead once the size has held still for settleTime, and
+//the renderer only asks once a frame, so a whole drag costs one reallocation at the end. Until then the renderer
+//keeps drawing into the targets it has, scaled to the new window.
+class ResizeCoordinator
+{
+public:
+    static constexpr std::chrono::milliseconds settleTime{ 100 };
+
+    struct Stats
+    {
+        //Size changes seen, reallocations allowed, and frames drawn into targets of the wrong size meanwhile
+        unsigned int resizes = 0;
+        unsigned int reallocations = 0;
+        unsigned int deferredFrames = 0;
+    };
+
+    //This records the window size for the frame. targetsMatch says whether the current targets are the ones this
+    //size wants, it returns true when they do not and it is time to reallocate them.
+    bool update(int width, int height, bool targetsMatch);
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    int width = 0;
+    int height = 0;
+    //When the size last changed
+    std::chrono::steady_clock::time_point changed;
+    Stats stats;
+};
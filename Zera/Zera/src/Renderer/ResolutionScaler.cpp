@@ -0,0 +1,65 @@
+#include "Renderer/ResolutionScaler.h"
+#include "Renderer/GpuProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+//The scale aims for this much of the budget, leaving room for frame to frame noise
+static const double headroom = 0.9;
+//Below this much of the budget there is room to scale up
+static const double growThreshold = 0.75;
+//The largest step taken when scaling up
+static const float growStep = 0.05f;
+//Scales are kept to multiples of this so noise does not change the resolution every time
+static const float scaleQuantum = 1.0f / 64.0f;
+
+void ResolutionScaler::configure(double budget, float minimum, float maximum)
+{
+    budgetMs = budget > 0.0 ? budget : 0.0;
+    maxScale = std::min(std::max(maximum, 0.1f), 1.0f);
+    minScale = std::min(std::max(minimum, 0.1f), maxScale);
+    scale = maxScale;
+    averageMs = 0.0;
+    //The first frames pay for shader compiles and driver warm up, they say nothing about the scene
+    settleFrames = GpuProfiler::frameSlots;
+}
+
+void ResolutionScaler::addSample(double gpuFrameMs)
+{
+    if (!isEnabled() || gpuFrameMs <= 0.0)
+    {
+        return;
+    }
+    if (settleFrames > 0)
+    {
+        settleFrames--;
+        return;
+    }
+    //Spikes are followed faster than drops, it is better to scale down a frame early than a frame late
+    double rate = gpuFrameMs > averageMs ? 0.5 : 0.1;
+    averageMs = averageMs == 0.0 ? gpuFrameMs : averageMs + (gpuFrameMs - averageMs) * rate;
+
+    float target = scale * (float)std::sqrt(budgetMs * headroom / averageMs);
+    float next;
+    if (averageMs > budgetMs)
+    {
+        next = target;
+    }
+    else if (averageMs < budgetMs * growThreshold)
+    {
+        next = std::min(target, scale + growStep);
+    }
+    else
+    {
+        return;
+    }
+    next = std::floor(next / scaleQuantum) * scaleQuantum;
+    next = std::min(std::max(next, minScale), maxScale);
+    if (next != scale)
+    {
+        scale = next;
+        averageMs = 0.0;
+        //Frames already queued on the GPU were rendered at the old scale
+        settleFrames = GpuProfiler::frameSlots;
+    }
+}
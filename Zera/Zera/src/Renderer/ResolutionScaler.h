@@ -0,0 +1,29 @@
+#pragma once
+
+//The resolution scaler picks how much of the window's resolution the scene is rendered at to keep the GPU frame
+//time under a budget. It is fed the GPU profiler's frame times, which arrive a few frames late, so after every
+//change it waits for measurements taken at the new scale before changing again. Scaling down assumes GPU time
+//goes with the pixel count, the square of the scale, and jumps straight to the scale that should fit. Scaling up
+//is done in small steps since not all of the frame's cost shrinks with the resolution.
+class ResolutionScaler
+{
+public:
+    //A budget of 0 turns scaling off and the scale stays at 1
+    void configure(double budgetMs, float minScale, float maxScale);
+    //This feeds the GPU time of one newly resolved frame
+    void addSample(double gpuFrameMs);
+
+    bool isEnabled() const { return budgetMs > 0.0; }
+    float getScale() const { return scale; }
+    float getMaxScale() const { return maxScale; }
+
+private:
+    double budgetMs = 0.0;
+    float minScale = 1.0f;
+    float maxScale = 1.0f;
+    float scale = 1.0f;
+    //Smoothed GPU frame time at the current scale, 0 until the first sample
+    double averageMs = 0.0;
+    //Samples still to skip after a change, they were rendered at the old scale
+    unsigned int settleFrames = 0;
+};
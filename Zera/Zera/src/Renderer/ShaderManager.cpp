@@ -0,0 +1,460 @@
+#include "Renderer/ShaderManager.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/VertexPacking.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+//Token from GL_KHR_parallel_shader_compile, the ARB version uses the same value
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+//The texture unit each sampler the engine's shaders declare reads from, the renderer binds textures to these
+struct SamplerUnit
+{
+    uint32_t nameHash;
+    int unit;
+};
+static constexpr SamplerUnit samplerUnits[] = { { hashName("uTexture"), 0 } };
+
+//Sampler units are program state like block bindings. They are found by hashed name in the reflected table, so
+//no string ever goes to GL, and programs without the sampler skip it.
+static void bindSamplerUnits(unsigned int program, const ProgramInterface& inputs)
+{
+    for (const SamplerUnit& sampler : samplerUnits)
+    {
+        int location = inputs.uniformLocation(sampler.nameHash);
+        if (location >= 0)
+        {
+            glState().useProgram(program);
+            glUniform1i(location, sampler.unit);
+        }
+    }
+}
+
+//Every cache file starts with this header, the version goes up whenever the layout changes
+struct BinaryHeader
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned long long key;
+    unsigned int format;
+    unsigned int length;
+};
+static const unsigned int binaryMagic = 0x4252505Au;
+static const unsigned int binaryVersion = 1;
+
+//FNV-1a, good enough to tell sources apart and fast enough to run over every shader at startup
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+//Strings are hashed with their terminator so "ab"+"c" and "a"+"bc" give different keys
+static uint64_t hashString(uint64_t hash, const char* text)
+{
+    return hashBytes(hash, text ? text : "", strlen(text ? text : "") + 1);
+}
+
+//This puts the defines and the shared source right after the #version line, which GLSL requires to come first
+static std::string applyDefines(const char* source, const char* defines, const std::string& shared)
+{
+    std::string result = source;
+    size_t insertAt = 0;
+    if (result.compare(0, 8, "#version") == 0)
+    {
+        size_t lineEnd = result.find('\n');
+        insertAt = lineEnd == std::string::npos ? result.size() : lineEnd + 1;
+    }
+    std::string block = defines ? defines : "";
+    if (!block.empty() && block.back() != '\n')
+    {
+        block += '\n';
+    }
+    block += shared;
+    result.insert(insertAt, block);
+    return result;
+}
+
+//glad keeps the driver's extensions in a hash set after loading, so this does not go back to the driver
+static bool hasExtension(const char* name)
+{
+    return gladHasExtension(name) != 0;
+}
+
+void ShaderManager::init(GLADloadproc loader, const std::string& cacheDirectory)
+{
+    stats = Stats();
+    const char* functionName = nullptr;
+    if (hasExtension("GL_KHR_parallel_shader_compile"))
+    {
+        functionName = "glMaxShaderCompilerThreadsKHR";
+    }
+    else if (hasExtension("GL_ARB_parallel_shader_compile"))
+    {
+        functionName = "glMaxShaderCompilerThreadsARB";
+    }
+    if (functionName)
+    {
+        PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)loader(functionName);
+        if (maxShaderCompilerThreads)
+        {
+            //0xFFFFFFFF means as many threads as the driver wants
+            maxShaderCompilerThreads(0xFFFFFFFFu);
+            stats.parallelCompile = true;
+        }
+    }
+
+    //Some drivers expose the extension with no binary formats, which means they cannot actually save anything
+    this->cacheDirectory.clear();
+    int formatCount = 0;
+    if (GLAD_GL_ARB_get_program_binary && !cacheDirectory.empty())
+    {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    }
+    if (formatCount > 0)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(cacheDirectory, error);
+        if (error)
+        {
+            std::cout << "ERROR::SHADER::CACHE::DIRECTORY_FAILED " << cacheDirectory << ": " << error.message() << std::endl;
+        }
+        else
+        {
+            this->cacheDirectory = cacheDirectory;
+            stats.binaryCache = true;
+        }
+    }
+
+    //With draw parameters a multi draw can tell its draws apart, which the render queue uses to merge draws.
+    //#extension has to come before anything that is not a preprocessor line, so it leads the vertex prelude.
+    stats.drawParameters = glCapabilities().drawParameters;
+    vertexPrelude = stats.drawParameters ? "#extension GL_ARB_shader_draw_parameters : require\n" : "";
+    vertexPrelude += uniformBlockSource();
+    vertexPrelude += drawIndexSource(stats.drawParameters);
+    vertexPrelude += vertexDecodeSource();
+
+    //Binaries are only valid for the exact driver that made them
+    driverHash = 14695981039346656037ull;
+    driverHash = hashString(driverHash, (const char*)glGetString(GL_VENDOR));
+    driverHash = hashString(driverHash, (const char*)glGetString(GL_RENDERER));
+    driverHash = hashString(driverHash, (const char*)glGetString(GL_VERSION));
+}
+
+void ShaderManager::shutdown()
+{
+    //Programs that were never drawn with are resolved anyway, so their binaries make it into the cache
+    prepareAll();
+    for (auto& entry : programs)
+    {
+        glState().deleteProgram(entry.first);
+    }
+    programs.clear();
+    pendingCount = 0;
+}
+
+void ShaderManager::compile(unsigned int program, Program& entry, const char* vertexSource, const char* fragmentSource)
+{
+    //No status queries here, each of them would wait for the compile it asks about
+    entry.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(entry.vertexShader, 1, &vertexSource, NULL);
+    glCompileShader(entry.vertexShader);
+    entry.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(entry.fragmentShader, 1, &fragmentSource, NULL);
+    glCompileShader(entry.fragmentShader);
+
+    glAttachShader(program, entry.vertexShader);
+    glAttachShader(program, entry.fragmentShader);
+    if (stats.binaryCache)
+    {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(program);
+}
+
+unsigned int ShaderManager::submit(const char* name, const char* vertexSource, const char* fragmentSource, const char* defines)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::string vertexText = applyDefines(vertexSource, defines, vertexPrelude);
+    std::string fragmentText = applyDefines(fragmentSource, defines, uniformBlockSource());
+
+    Program entry;
+    entry.name = name;
+    unsigned int program = glCreateProgram();
+    if (stats.binaryCache)
+    {
+        entry.cacheKey = hashString(hashString(hashString(driverHash, vertexText.c_str()), fragmentText.c_str()), defines);
+        entry.fromCache = loadBinary(program, entry.cacheKey);
+    }
+    if (entry.fromCache)
+    {
+        //The driver can still turn the binary down at first use, the sources are kept to compile it then
+        entry.vertexSource = vertexText;
+        entry.fragmentSource = fragmentText;
+        stats.cacheHits++;
+    }
+    else
+    {
+        compile(program, entry, vertexText.c_str(), fragmentText.c_str());
+        if (stats.binaryCache)
+        {
+            stats.cacheMisses++;
+        }
+    }
+
+    programs[program] = entry;
+    pendingCount++;
+    stats.submitted++;
+    stats.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return program;
+}
+
+void ShaderManager::resolve(unsigned int program, Program& entry)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    //Programs report their link status through glGetProgramiv, not glGetShaderiv
+    int success;
+    char infoLog[512];
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success && entry.fromCache)
+    {
+        //A rejected binary leaves the program unlinked, so it can be compiled and linked again under the same
+        //name. This one waits for the compile, which only happens the first launch after a driver change.
+        stats.cacheStale++;
+        entry.fromCache = false;
+        compile(program, entry, entry.vertexSource.c_str(), entry.fragmentSource.c_str());
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+    }
+    entry.vertexSource.clear();
+    entry.fragmentSource.clear();
+    entry.linked = success != 0;
+    if (entry.linked)
+    {
+        //Block bindings are program state set after linking, so binaries do not carry them and they are set every time
+        bindUniformBlocks(program);
+        entry.inputs.reflect(program);
+        bindSamplerUnits(program, entry.inputs);
+    }
+    if (entry.fromCache)
+    {
+        entry.resolved = true;
+        pendingCount--;
+        stats.resolveMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return;
+    }
+    if (entry.linked && stats.binaryCache)
+    {
+        saveBinary(program, entry.cacheKey);
+    }
+    if (!entry.linked)
+    {
+        //Only now is it worth asking the shaders why, a failed compile always shows up as a failed link
+        glGetShaderiv(entry.vertexShader, GL_COMPILE_STATUS, &success);
+        if (!success)
+        {
+            glGetShaderInfoLog(entry.vertexShader, 512, NULL, infoLog);
+            std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED (" << entry.name << ")\n" << infoLog << std::endl;
+        }
+        glGetShaderiv(entry.fragmentShader, GL_COMPILE_STATUS, &success);
+        if (!success)
+        {
+            glGetShaderInfoLog(entry.fragmentShader, 512, NULL, infoLog);
+            std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED (" << entry.name << ")\n" << infoLog << std::endl;
+        }
+        glGetProgramInfoLog(program, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED (" << entry.name << ")\n" << infoLog << std::endl;
+        stats.failed++;
+    }
+
+    //The linked program keeps its own copy of the code, so the shader objects can go
+    glDetachShader(program, entry.vertexShader);
+    glDetachShader(program, entry.fragmentShader);
+    glDeleteShader(entry.vertexShader);
+    glDeleteShader(entry.fragmentShader);
+    entry.vertexShader = entry.fragmentShader = 0;
+    entry.resolved = true;
+    pendingCount--;
+    stats.resolveMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool ShaderManager::prepare(unsigned int program)
+{
+    auto found = programs.find(program);
+    if (found == programs.end())
+    {
+        //Programs the manager did not create are assumed to be usable
+        return program != 0;
+    }
+    if (!found->second.resolved)
+    {
+        resolve(program, found->second);
+    }
+    return found->second.linked;
+}
+
+void ShaderManager::prepareAll()
+{
+    if (pendingCount == 0)
+    {
+        return;
+    }
+    for (auto& entry : programs)
+    {
+        if (!entry.second.resolved)
+        {
+            resolve(entry.first, entry.second);
+        }
+    }
+}
+
+const ProgramInterface* ShaderManager::getInterface(unsigned int program)
+{
+    auto found = programs.find(program);
+    if (found == programs.end() || !prepare(program))
+    {
+        return nullptr;
+    }
+    return &found->second.inputs;
+}
+
+bool ShaderManager::validateVertexInputs(unsigned int program, unsigned int vertexArray, const char* what)
+{
+    const ProgramInterface* inputs = getInterface(program);
+    if (!inputs)
+    {
+        return false;
+    }
+    const std::string& name = programs[program].name;
+
+    bool valid = true;
+    glState().bindVertexArray(vertexArray);
+    for (const ShaderInput& input : inputs->getAttributes())
+    {
+        //The draw index is a constant attribute set per draw, no VAO is meant to have an array for it
+        if (input.location == (int)drawIndexLocation)
+        {
+            continue;
+        }
+        int locations = attributeLocationCount(input.type) * input.size;
+        for (int location = input.location; location < input.location + locations; location++)
+        {
+            int enabled = 0;
+            int integer = 0;
+            glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+            glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &integer);
+            if (!enabled)
+            {
+                std::cout << "ERROR::SHADER::VERTEX_INPUT_MISSING (" << name << " with " << what << ") " << input.name
+                    << " at location " << location << " has no array in the VAO" << std::endl;
+                valid = false;
+            }
+            else if ((integer != 0) != isIntegerAttribute(input.type))
+            {
+                std::cout << "ERROR::SHADER::VERTEX_INPUT_TYPE (" << name << " with " << what << ") " << input.name
+                    << " at location " << location << (integer ? " is an integer array read as float" : " is a float array read as integer") << std::endl;
+                valid = false;
+            }
+        }
+    }
+    return valid;
+}
+
+void ShaderManager::release(unsigned int program)
+{
+    auto found = programs.find(program);
+    if (found != programs.end())
+    {
+        if (!found->second.resolved)
+        {
+            resolve(program, found->second);
+        }
+        programs.erase(found);
+    }
+    glState().deleteProgram(program);
+}
+
+std::string ShaderManager::cachePath(uint64_t key) const
+{
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "%016llx.bin", (unsigned long long)key);
+    return (std::filesystem::path(cacheDirectory) / fileName).string();
+}
+
+bool ShaderManager::loadBinary(unsigned int program, uint64_t key)
+{
+    std::ifstream file(cachePath(key), std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    BinaryHeader header;
+    if (!file.read((char*)&header, sizeof(header)) || header.magic != binaryMagic || header.version != binaryVersion ||
+        header.key != key || header.length == 0)
+    {
+        return false;
+    }
+    std::vector<char> binary(header.length);
+    if (!file.read(binary.data(), header.length))
+    {
+        return false;
+    }
+    glProgramBinary(program, header.format, binary.data(), (GLsizei)header.length);
+    return true;
+}
+
+void ShaderManager::saveBinary(unsigned int program, uint64_t key)
+{
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    //This writes to a temporary file first so a crash halfway through never leaves a truncated binary behind
+    std::string path = cachePath(key);
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        BinaryHeader header = { binaryMagic, binaryVersion, key, format, (unsigned int)length };
+        if (!file.write((const char*)&header, sizeof(header)) || !file.write(binary.data(), length))
+        {
+            std::cout << "ERROR::SHADER::CACHE::WRITE_FAILED " << tempPath << std::endl;
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::cout << "ERROR::SHADER::CACHE::WRITE_FAILED " << path << ": " << error.message() << std::endl;
+    }
+}
+
+ShaderManager& shaderManager()
+{
+    static ShaderManager manager;
+    return manager;
+}
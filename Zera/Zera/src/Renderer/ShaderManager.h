@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Renderer/ShaderReflection.h"
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+//The shader manager kicks off every compile and link as soon as it is asked to and only checks the results
+//when a program is first used. Asking for GL_COMPILE_STATUS right after glCompileShader makes the driver
+//finish that compile before returning, so compiling one shader after another that way serializes the whole
+//startup. Submitting everything first lets the driver overlap the work, and with
+//GL_KHR_parallel_shader_compile it really does compile on its own threads while we keep loading.
+//Linked programs are also saved to a cache directory with GL_ARB_get_program_binary, so later launches load
+//the driver's binary instead of compiling at all.
+//Like the GL context, the manager must only be used by the thread that has the context current.
+class ShaderManager
+{
+public:
+    struct Stats
+    {
+        unsigned int submitted = 0;
+        unsigned int failed = 0;
+        //Time spent issuing compiles and links, and time spent blocked on results at first use
+        double submitMs = 0.0;
+        double resolveMs = 0.0;
+        bool parallelCompile = false;
+        //Programs loaded from the binary cache, compiled because nothing was cached, and cached binaries the
+        //driver rejected (a driver update usually) which were compiled again
+        unsigned int cacheHits = 0;
+        unsigned int cacheMisses = 0;
+        unsigned int cacheStale = 0;
+        bool binaryCache = false;
+        //GL_ARB_shader_draw_parameters, DRAW_INDEX includes gl_DrawIDARB
+        bool drawParameters = false;
+    };
+
+    //This looks for the parallel compile extension and lets the driver use as many threads as it likes.
+    //Binaries are cached in cacheDirectory, an empty string turns the cache off.
+    void init(GLADloadproc loader, const std::string& cacheDirectory);
+    //This deletes every program the manager still knows about, resolving any that were never used
+    void shutdown();
+
+    //This starts compiling and linking, or loads the cached binary, and returns the program name straight away
+    //without checking anything. The name can be recorded into commands right away, the renderer resolves it
+    //before binding it. Defines and the shared uniform blocks (see UniformBuffer.h) are inserted after the
+    //#version line of both stages, vertex shaders also get aDrawIndex, DRAW_INDEX and decodeOctahedral.
+    unsigned int submit(const char* name, const char* vertexSource, const char* fragmentSource, const char* defines = "");
+    //This makes sure the program has finished linking, printing the logs if it failed. Programs that are already
+    //resolved cost one hash lookup. Returns false if the program cannot be used.
+    bool prepare(unsigned int program);
+    //This resolves every program that is still pending, for the end of a loading screen
+    void prepareAll();
+    //The program's active uniforms and inputs, reflected when it linked. Resolves the program, null if it failed.
+    const ProgramInterface* getInterface(unsigned int program);
+    //This checks that a VAO feeds every vertex input the program reads, with the right integer or float type,
+    //and prints what is missing. It resolves the program, so call it once loading has submitted its shaders.
+    bool validateVertexInputs(unsigned int program, unsigned int vertexArray, const char* what);
+    //This deletes a program from the manager and GL, resolving it first if it was never used
+    void release(unsigned int program);
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Program
+    {
+        std::string name;
+        unsigned int vertexShader = 0;
+        unsigned int fragmentShader = 0;
+        //Sources are only kept for cached programs, in case the driver rejects the binary
+        std::string vertexSource;
+        std::string fragmentSource;
+        uint64_t cacheKey = 0;
+        bool fromCache = false;
+        bool resolved = false;
+        bool linked = false;
+        ProgramInterface inputs;
+    };
+
+    void compile(unsigned int program, Program& entry, const char* vertexSource, const char* fragmentSource);
+    void resolve(unsigned int program, Program& entry);
+    std::string cachePath(uint64_t key) const;
+    bool loadBinary(unsigned int program, uint64_t key);
+    void saveBinary(unsigned int program, uint64_t key);
+
+    std::unordered_map<unsigned int, Program> programs;
+    unsigned int pendingCount = 0;
+    std::string cacheDirectory;
+    //Hash of the driver strings, every cache key starts from it so a new driver never sees old binaries
+    uint64_t driverHash = 0;
+    //Everything inserted after #version in vertex shaders, built at init since it depends on the driver
+    std::string vertexPrelude;
+    Stats stats;
+};
+
+//Shaders are tied to the one GL context, so the manager is global like the state cache
+ShaderManager& shaderManager();
@@ -0,0 +1,146 @@
+#include "Renderer/ShaderReflection.h"
+
+#include <iostream>
+
+bool NameTable::build(const std::vector<uint32_t>& hashes, const std::vector<int>& values)
+{
+    slots.clear();
+    if (hashes.empty())
+    {
+        return true;
+    }
+
+    //Start at the smallest power of two that fits and double it if no multiplier works, tables are tiny
+    //(a program has a handful of inputs) so a few hundred tries per size costs nothing at link time
+    unsigned int bits = 1;
+    while ((1u << bits) < hashes.size())
+    {
+        bits++;
+    }
+    std::vector<Slot> candidate;
+    for (; bits <= 16; bits++)
+    {
+        uint32_t seed = 0x9E3779B9u;
+        for (int attempt = 0; attempt < 256; attempt++)
+        {
+            //Odd multipliers from a simple LCG, odd so every bit of the hash reaches the top bits
+            seed = seed * 1664525u + 1013904223u;
+            uint32_t tryMultiplier = seed | 1u;
+            unsigned int tryShift = 32 - bits;
+            candidate.assign((size_t)1 << bits, Slot{ 0, -1 });
+            std::vector<bool> used((size_t)1 << bits, false);
+            bool collided = false;
+            for (size_t i = 0; i < hashes.size() && !collided; i++)
+            {
+                uint32_t index = (uint32_t)(hashes[i] * tryMultiplier) >> tryShift;
+                if (used[index])
+                {
+                    //Two identical hashes can never be separated, give up straight away
+                    if (candidate[index].hash == hashes[i])
+                    {
+                        std::cout << "ERROR::SHADER::REFLECTION::NAME_HASH_COLLISION " << hashes[i] << std::endl;
+                        return false;
+                    }
+                    collided = true;
+                }
+                used[index] = true;
+                candidate[index] = Slot{ hashes[i], values[i] };
+            }
+            if (!collided)
+            {
+                slots.swap(candidate);
+                multiplier = tryMultiplier;
+                shift = tryShift;
+                return true;
+            }
+        }
+    }
+    std::cout << "ERROR::SHADER::REFLECTION::NO_PERFECT_HASH for " << hashes.size() << " names" << std::endl;
+    return false;
+}
+
+//GL reports arrays as "name[0]", lookups use the plain name
+static std::string baseName(const char* name)
+{
+    std::string result = name;
+    size_t bracket = result.find('[');
+    if (bracket != std::string::npos)
+    {
+        result.erase(bracket);
+    }
+    return result;
+}
+
+void ProgramInterface::reflect(unsigned int program)
+{
+    uniforms.clear();
+    attributes.clear();
+    char name[256];
+
+    int count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+    for (int i = 0; i < count; i++)
+    {
+        ShaderInput input;
+        GLsizei length = 0;
+        glGetActiveUniform(program, (GLuint)i, sizeof(name), &length, &input.size, &input.type, name);
+        input.location = glGetUniformLocation(program, name);
+        //Block members report -1, they are set through the uniform buffer
+        if (input.location < 0)
+        {
+            continue;
+        }
+        input.name = baseName(name);
+        input.nameHash = hashName(input.name.c_str());
+        uniforms.push_back(input);
+    }
+
+    glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+    for (int i = 0; i < count; i++)
+    {
+        ShaderInput input;
+        GLsizei length = 0;
+        glGetActiveAttrib(program, (GLuint)i, sizeof(name), &length, &input.size, &input.type, name);
+        input.location = glGetAttribLocation(program, name);
+        //Built in inputs like gl_VertexID are active but have no location
+        if (input.location < 0)
+        {
+            continue;
+        }
+        input.name = baseName(name);
+        input.nameHash = hashName(input.name.c_str());
+        attributes.push_back(input);
+    }
+
+    std::vector<uint32_t> hashes;
+    std::vector<int> locations;
+    for (const ShaderInput& input : uniforms)
+    {
+        hashes.push_back(input.nameHash);
+        locations.push_back(input.location);
+    }
+    uniformTable.build(hashes, locations);
+}
+
+int attributeLocationCount(GLenum type)
+{
+    switch (type)
+    {
+    case GL_FLOAT_MAT2: case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT2x4: return 2;
+    case GL_FLOAT_MAT3: case GL_FLOAT_MAT3x2: case GL_FLOAT_MAT3x4: return 3;
+    case GL_FLOAT_MAT4: case GL_FLOAT_MAT4x2: case GL_FLOAT_MAT4x3: return 4;
+    default: return 1;
+    }
+}
+
+bool isIntegerAttribute(GLenum type)
+{
+    switch (type)
+    {
+    case GL_INT: case GL_INT_VEC2: case GL_INT_VEC3: case GL_INT_VEC4:
+    case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2: case GL_UNSIGNED_INT_VEC3: case GL_UNSIGNED_INT_VEC4:
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//FNV-1a over the name, constexpr so hot code hashes its uniform names at compile time:
+//    constexpr uint32_t textureName = hashName("uTexture");
+constexpr uint32_t hashName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+    while (*name)
+    {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+//A fixed set of name hashes mapped to values with a perfect hash, so a lookup is one multiply, one shift and
+//one compare with no probing. The multiplier is searched for when the table is built.
+class NameTable
+{
+public:
+    //This builds the table, returns false if two names have the same hash (the table is left empty then)
+    bool build(const std::vector<uint32_t>& hashes, const std::vector<int>& values);
+    //Returns the value stored for the hash, or -1 if it is not in the table
+    int find(uint32_t hash) const
+    {
+        if (slots.empty())
+        {
+            return -1;
+        }
+        const Slot& slot = slots[(uint32_t)(hash * multiplier) >> shift];
+        return slot.hash == hash ? slot.value : -1;
+    }
+
+private:
+    struct Slot
+    {
+        uint32_t hash;
+        int value;
+    };
+
+    std::vector<Slot> slots;
+    uint32_t multiplier = 1;
+    unsigned int shift = 31;
+};
+
+//An active uniform or vertex input of a linked program, as GL reports it
+struct ShaderInput
+{
+    std::string name;
+    uint32_t nameHash;
+    int location;
+    GLenum type;
+    int size;
+};
+
+//Everything the renderer needs to know about a program's interface, gathered once right after it links so no
+//draw ever has to ask GL for a location by string. Loose uniforms (everything outside the blocks, which today
+//is only samplers) are looked up by hashed name, vertex inputs are checked against VAOs from the list.
+class ProgramInterface
+{
+public:
+    //This queries the active uniforms and attributes of a linked program. Uniforms inside blocks have no
+    //location and are left to the uniform buffer.
+    void reflect(unsigned int program);
+
+    //Location by hashed name, -1 when the program has no such active uniform
+    int uniformLocation(uint32_t nameHash) const { return uniformTable.find(nameHash); }
+
+    const std::vector<ShaderInput>& getUniforms() const { return uniforms; }
+    const std::vector<ShaderInput>& getAttributes() const { return attributes; }
+
+private:
+    std::vector<ShaderInput> uniforms;
+    std::vector<ShaderInput> attributes;
+    NameTable uniformTable;
+};
+
+//How many attribute locations an input of this type takes, matrices take one per column
+int attributeLocationCount(GLenum type);
+//True for int and uint inputs, which need glVertexAttribIPointer rather than glVertexAttribPointer
+bool isIntegerAttribute(GLenum type);
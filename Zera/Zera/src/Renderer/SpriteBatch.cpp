@@ -0,0 +1,51 @@
+#include "Renderer/SpriteBatch.h"
+
+void SpriteBatch::begin(float viewWidth, float viewHeight)
+{
+    clear();
+
+    //Column major orthographic projection with (0, 0) in the top left corner and y pointing down
+    for (int i = 0; i < 16; i++)
+    {
+        projection[i] = 0.0f;
+    }
+    projection[0] = 2.0f / viewWidth;
+    projection[5] = -2.0f / viewHeight;
+    projection[10] = -1.0f;
+    projection[12] = -1.0f;
+    projection[13] = 1.0f;
+    projection[15] = 1.0f;
+}
+
+void SpriteBatch::clear()
+{
+    vertices.clear();
+    batches.clear();
+    currentProgram = 0;
+}
+
+void SpriteBatch::setShader(unsigned int program)
+{
+    currentProgram = program;
+}
+
+void SpriteBatch::draw(unsigned int texture, float x, float y, float width, float height, unsigned int color)
+{
+    draw(texture, x, y, width, height, 0.0f, 0.0f, 1.0f, 1.0f, color);
+}
+
+void SpriteBatch::draw(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, unsigned int color)
+{
+    //This is the "flush" point, a new batch only starts when the shader or texture changes
+    unsigned int quadIndex = (unsigned int)(vertices.size() / 4);
+    if (batches.empty() || batches.back().texture != texture || batches.back().program != currentProgram)
+    {
+        batches.push_back({ currentProgram, texture, quadIndex, 0 });
+    }
+    batches.back().quadCount++;
+
+    vertices.push_back({ x, y, u0, v0, color });
+    vertices.push_back({ x + width, y, u1, v0, color });
+    vertices.push_back({ x + width, y + height, u1, v1, color });
+    vertices.push_back({ x, y + height, u0, v1, color });
+}
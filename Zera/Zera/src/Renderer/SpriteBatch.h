@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+//One corner of a sprite quad, positions are in pixels and color is packed RGBA (0xAABBGGRR)
+struct SpriteVertex
+{
+    float x, y;
+    float u, v;
+    unsigned int color;
+};
+
+//The sprite batch gathers every quad of a frame on the CPU, it never touches GL so it can be recorded on
+//the main thread while the render thread draws the previous frame. Quads are split into batches that share
+//the same shader and texture, the SpriteRenderer uploads them all at once and draws one batch per call.
+class SpriteBatch
+{
+public:
+    //A run of quads that share the same shader and texture, program 0 is the built in sprite shader
+    struct Batch
+    {
+        unsigned int program;
+        unsigned int texture;
+        unsigned int firstQuad;
+        unsigned int quadCount;
+    };
+
+    //This starts a new frame of sprites using a pixel space projection of the given size
+    void begin(float viewWidth, float viewHeight);
+    //This swaps the shader used for the following sprites, 0 goes back to the built in sprite shader
+    void setShader(unsigned int program);
+    void draw(unsigned int texture, float x, float y, float width, float height, unsigned int color);
+    void draw(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, unsigned int color);
+    //This drops everything recorded so far, an empty batch draws nothing
+    void clear();
+
+    const std::vector<SpriteVertex>& getVertices() const { return vertices; }
+    const std::vector<Batch>& getBatches() const { return batches; }
+    const float* getProjection() const { return projection; }
+
+private:
+    std::vector<SpriteVertex> vertices;
+    std::vector<Batch> batches;
+    float projection[16] = {};
+    unsigned int currentProgram = 0;
+};
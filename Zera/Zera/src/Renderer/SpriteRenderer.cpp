@@ -0,0 +1,136 @@
+#include "Renderer/SpriteRenderer.h"
+#include "Core/Profiler.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/StreamBuffer.h"
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/VertexLayout.h"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+//Sprite vertices as they sit in the stream, color is four normalized bytes
+static constexpr VertexLayout spriteLayout = makeVertexLayout<SpriteVertex>(0,
+    VERTEX_ATTRIBUTE(SpriteVertex, x, PositionAttribute, 2, GL_FLOAT, false),
+    VERTEX_ATTRIBUTE(SpriteVertex, u, TexCoordAttribute, 2, GL_FLOAT, false),
+    VERTEX_ATTRIBUTE(SpriteVertex, color, ColorAttribute, 4, GL_UNSIGNED_BYTE, true));
+static_assert(spriteLayout.isValid(), "spriteLayout does not describe SpriteVertex");
+
+//Sprite vertex shader, positions come in as pixels and get moved into clip space by the view block
+static const char* spriteVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec2 aPos;\n"
+"layout (location = 1) in vec2 aUV;\n"
+"layout (location = 2) in vec4 aColor;\n"
+"out vec2 vUV;\n"
+"out vec4 vColor;\n"
+"void main()\n"
+"{\n"
+"   vUV = aUV;\n"
+"   vColor = aColor;\n"
+"   gl_Position = view.viewProjection * vec4(aPos, 0.0, 1.0);\n"
+"}\0";
+//Sprite fragment shader, tints the texture by the vertex color
+static const char* spriteFragmentShaderSource = "#version 330 core\n"
+"in vec2 vUV;\n"
+"in vec4 vColor;\n"
+"uniform sampler2D uTexture;\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"   FragColor = texture(uTexture, vUV) * vColor;\n"
+"}\n\0";
+
+bool SpriteRenderer::init(const StreamBuffer& stream)
+{
+    defaultProgram = shaderManager().submit("sprite", spriteVertexShaderSource, spriteFragmentShaderSource);
+    if (!defaultProgram)
+    {
+        return false;
+    }
+
+    //Every quad uses the same 6 indices offset by 4 vertices, so the whole index buffer is built once up front
+    std::vector<unsigned short> indices(maxQuadsPerDraw * 6);
+    for (unsigned int quad = 0; quad < maxQuadsPerDraw; quad++)
+    {
+        unsigned short first = (unsigned short)(quad * 4);
+        indices[quad * 6 + 0] = first + 0;
+        indices[quad * 6 + 1] = first + 1;
+        indices[quad * 6 + 2] = first + 2;
+        indices[quad * 6 + 3] = first + 2;
+        indices[quad * 6 + 4] = first + 3;
+        indices[quad * 6 + 5] = first + 0;
+    }
+
+    glGenBuffers(1, &EBO);
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, EBO);
+    glBufferData(GL_COPY_WRITE_BUFFER, indices.size() * sizeof(unsigned short), indices.data(), GL_STATIC_DRAW);
+    VAO = vertexArrays().get(spriteLayout, stream.getBuffer(), EBO);
+
+    //Custom sprite shaders are checked by whoever made them, the built in one is checked here
+    bool valid = shaderManager().validateVertexInputs(defaultProgram, VAO, "sprite vertices");
+    glState().bindVertexArray(0);
+    glState().bindBuffer(GL_ARRAY_BUFFER, 0);
+    return valid;
+}
+
+void SpriteRenderer::shutdown()
+{
+    vertexArrays().release(EBO);
+    glState().deleteBuffer(EBO);
+    shaderManager().release(defaultProgram);
+    VAO = EBO = defaultProgram = 0;
+}
+
+unsigned int SpriteRenderer::submit(const SpriteBatch& batch, StreamBuffer& stream, UniformBuffer& uniforms)
+{
+    ZERA_PROFILE_SCOPE("sprites submit");
+    const std::vector<SpriteVertex>& vertices = batch.getVertices();
+    if (vertices.empty())
+    {
+        return 0;
+    }
+
+    //This streams the whole frame of vertices in one write, the offset is a whole number of vertices so it
+    //can simply be added to every draw's base vertex
+    size_t offset = stream.write(vertices.data(), vertices.size() * sizeof(SpriteVertex), sizeof(SpriteVertex));
+    unsigned int firstVertex = (unsigned int)(offset / sizeof(SpriteVertex));
+
+    glState().setDepthTest(false);
+    glState().setBlend(true);
+    glState().blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glState().bindVertexArray(VAO);
+
+    //The projection is bound once as the view block for every sprite shader. Samplers were pointed at unit 0, where
+    //the texture goes, when the program linked, so switching programs needs no uniform calls at all.
+    ViewConstants view;
+    memcpy(view.viewProjection, batch.getProjection(), sizeof(view.viewProjection));
+    uniforms.bind(ViewBinding, view);
+
+    unsigned int drawCalls = 0;
+    for (const SpriteBatch::Batch& run : batch.getBatches())
+    {
+        unsigned int program = run.program ? run.program : defaultProgram;
+        if (!shaderManager().prepare(program))
+        {
+            continue;
+        }
+        glState().useProgram(program);
+        glState().bindTexture(0, GL_TEXTURE_2D, run.texture);
+
+        //Batches bigger than the index buffer are split, base vertex moves the shared indices onto the right quads
+        for (unsigned int drawn = 0; drawn < run.quadCount; drawn += maxQuadsPerDraw)
+        {
+            unsigned int count = run.quadCount - drawn;
+            if (count > maxQuadsPerDraw)
+            {
+                count = maxQuadsPerDraw;
+            }
+            glDrawElementsBaseVertex(GL_TRIANGLES, count * 6, GL_UNSIGNED_SHORT, 0, firstVertex + (run.firstQuad + drawn) * 4);
+            drawCalls++;
+        }
+    }
+    return drawCalls;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Renderer/SpriteBatch.h"
+
+class StreamBuffer;
+class UniformBuffer;
+
+//The GL side of sprite batching. Vertices are streamed into the renderer's ring buffer and drawn with a shared,
+//precomputed quad index buffer, one glDrawElementsBaseVertex per batch (or per 16384 quads, the 16 bit limit).
+class SpriteRenderer
+{
+public:
+    //Quads per draw call, 16384 quads * 4 corners is exactly the range of an unsigned short index
+    static const unsigned int maxQuadsPerDraw = 16384;
+
+    //The VAO reads its vertices straight out of the stream buffer
+    bool init(const StreamBuffer& stream);
+    void shutdown();
+
+    //This writes every recorded quad into the stream in one go and issues the draws, returns the number of draw calls
+    unsigned int submit(const SpriteBatch& batch, StreamBuffer& stream, UniformBuffer& uniforms);
+
+private:
+    unsigned int VAO = 0, EBO = 0;
+    unsigned int defaultProgram = 0;
+};
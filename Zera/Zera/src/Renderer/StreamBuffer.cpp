@@ -0,0 +1,216 @@
+#include "Renderer/StreamBuffer.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+//True if [begin, end) touches a region of the ring, wrapped regions cover [regionBegin, capacity) and [0, regionEnd)
+static bool overlaps(size_t begin, size_t end, size_t regionBegin, size_t regionEnd, bool wrapped)
+{
+    if (!wrapped)
+    {
+        return begin < regionEnd && regionBegin < end;
+    }
+    return regionBegin < end || begin < regionEnd;
+}
+
+bool StreamBuffer::init(GLenum target, size_t size)
+{
+    capacity = size;
+    glGenBuffers(1, &buffer);
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    persistentMapping = nullptr;
+    if (glCapabilities().bufferStorage)
+    {
+        //Coherent so writes are seen by the GPU without flushing, the fences still keep us off memory it is reading
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_WRITE_BUFFER, capacity, NULL, flags);
+        persistentMapping = (char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, capacity, flags);
+        if (!persistentMapping)
+        {
+            std::cout << "ERROR::STREAMBUFFER::PERSISTENT_MAP_FAILED" << std::endl;
+            glState().deleteBuffer(buffer);
+            buffer = 0;
+            return false;
+        }
+    }
+    else
+    {
+        glBufferData(GL_COPY_WRITE_BUFFER, capacity, NULL, target == GL_UNIFORM_BUFFER ? GL_DYNAMIC_DRAW : GL_STREAM_DRAW);
+    }
+    head = 0;
+    frameBegin = 0;
+    frameWrapped = false;
+    stats = Stats();
+    stats.capacity = capacity;
+    stats.persistent = persistentMapping != nullptr;
+    return buffer != 0;
+}
+
+void StreamBuffer::shutdown()
+{
+    for (Region& region : inFlight)
+    {
+        glDeleteSync(region.fence);
+    }
+    inFlight.clear();
+    if (persistentMapping)
+    {
+        glState().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        persistentMapping = nullptr;
+    }
+    glState().deleteBuffer(buffer);
+    buffer = 0;
+    capacity = 0;
+}
+
+bool StreamBuffer::overlapsInFlight(size_t begin, size_t end) const
+{
+    for (const Region& region : inFlight)
+    {
+        if (overlaps(begin, end, region.begin, region.end, region.wrapped))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void StreamBuffer::waitForOldest()
+{
+    auto start = std::chrono::steady_clock::now();
+    Region region = inFlight.front();
+    inFlight.pop_front();
+    //The flush bit makes sure the fence is actually sent to the GPU before we wait on it
+    GLenum result = glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        result = glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+    }
+    glDeleteSync(region.fence);
+    frameWaitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    frameWaits++;
+}
+
+size_t StreamBuffer::reserve(size_t size, size_t alignment)
+{
+    size_t begin = (head + alignment - 1) / alignment * alignment;
+    bool wrapsNow = begin + size > capacity;
+    if (wrapsNow)
+    {
+        //Not enough room before the end, the tail is skipped and the write starts over at 0
+        begin = 0;
+    }
+    size_t end = begin + size;
+
+    //If the frame has gone all the way around onto its own start, the frame's earlier draws have to finish
+    //before we overwrite their data, so fence what we have and let the wait below catch it
+    bool hitsOwnFrame;
+    if (!frameWrapped)
+    {
+        hitsOwnFrame = wrapsNow && frameBegin < head && end > frameBegin;
+    }
+    else
+    {
+        hitsOwnFrame = wrapsNow || end >= frameBegin;
+    }
+    if (hitsOwnFrame)
+    {
+        fenceFrame();
+    }
+    frameWrapped = frameWrapped || wrapsNow;
+
+    while (overlapsInFlight(begin, end))
+    {
+        waitForOldest();
+    }
+
+    head = end;
+    frameBytes += size;
+    return begin;
+}
+
+size_t StreamBuffer::write(const void* data, size_t size, size_t alignment)
+{
+    size_t offset = 0;
+    void* mapped = map(size, alignment, offset);
+    if (mapped)
+    {
+        memcpy(mapped, data, size);
+        unmap();
+    }
+    return offset;
+}
+
+void* StreamBuffer::map(size_t size, size_t alignment, size_t& offset)
+{
+    offset = 0;
+    if (size == 0 || size > capacity)
+    {
+        if (size > capacity)
+        {
+            std::cout << "ERROR::STREAMBUFFER::ALLOCATION_TOO_BIG " << size << " bytes, ring is " << capacity << std::endl;
+        }
+        return nullptr;
+    }
+
+    offset = reserve(size, alignment);
+    if (persistentMapping)
+    {
+        return persistentMapping + offset;
+    }
+    //Unsynchronized because the fences in reserve already guarantee the GPU is done with this range
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    return glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+}
+
+void StreamBuffer::unmap()
+{
+    if (persistentMapping)
+    {
+        return;
+    }
+    glState().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+}
+
+void StreamBuffer::fenceFrame()
+{
+    if (head != frameBegin || frameWrapped)
+    {
+        Region region;
+        region.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        region.begin = frameBegin;
+        region.end = head;
+        region.wrapped = frameWrapped;
+        inFlight.push_back(region);
+    }
+    frameBegin = head;
+    frameWrapped = false;
+}
+
+void StreamBuffer::endFrame()
+{
+    fenceFrame();
+
+    //Frames the GPU has already finished with are retired without waiting, so fences do not pile up
+    while (!inFlight.empty() && glClientWaitSync(inFlight.front().fence, 0, 0) != GL_TIMEOUT_EXPIRED)
+    {
+        glDeleteSync(inFlight.front().fence);
+        inFlight.pop_front();
+    }
+
+    stats.frameBytes = frameBytes;
+    stats.waitMs = frameWaitMs;
+    stats.waits = frameWaits;
+    if (frameBytes > stats.peakFrameBytes)
+    {
+        stats.peakFrameBytes = frameBytes;
+    }
+    frameBytes = 0;
+    frameWaitMs = 0.0;
+    frameWaits = 0;
+}
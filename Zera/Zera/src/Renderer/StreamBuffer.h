@@ -0,0 +1,83 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <deque>
+
+//The stream buffer is a ring of GPU memory for data that changes every frame (sprites, instances, debug lines,
+//particles). Space is handed out front to back and written through glMapBufferRange with
+//GL_MAP_UNSYNCHRONIZED_BIT, so the driver never stalls or orphans the buffer behind our back. Instead
+//endFrame() drops a fence after each frame's draws and the ring only waits on that fence when it wraps
+//around onto memory the GPU may still be reading.
+//With GL_ARB_buffer_storage the ring is allocated immutable and mapped once, persistent and coherent, at init.
+//map() is then just a pointer into that mapping and unmap() does nothing, the fences work the same either way.
+class StreamBuffer
+{
+public:
+    //Numbers for the last finished frame (plus the peak), updated by endFrame
+    struct Stats
+    {
+        size_t capacity = 0;
+        //Bytes handed out during the frame
+        size_t frameBytes = 0;
+        //Biggest frame seen so far, to size the ring
+        size_t peakFrameBytes = 0;
+        //Time spent in glClientWaitSync during the frame, and how many waits there were
+        double waitMs = 0.0;
+        unsigned int waits = 0;
+        //True when the ring is mapped persistently with buffer storage
+        bool persistent = false;
+    };
+
+    //This creates the ring, target is only used for its usage hint (the buffer is always mapped through GL_COPY_WRITE_BUFFER)
+    bool init(GLenum target, size_t capacity);
+    void shutdown();
+
+    //This reserves size bytes, with the offset rounded up to a multiple of alignment (any value, not only powers of two),
+    //copies data in and returns the offset in the buffer. Draws reading the data must be issued before the next write.
+    size_t write(const void* data, size_t size, size_t alignment);
+    //This reserves space like write does but hands back the mapped memory to fill in place, which saves a copy
+    //when the data is being gathered anyway. unmap() must be called before anything else touches the ring.
+    //Returns null if the space could not be reserved.
+    void* map(size_t size, size_t alignment, size_t& offset);
+    void unmap();
+    //This fences everything written since the last endFrame, call it after the frame's draws are issued
+    void endFrame();
+
+    unsigned int getBuffer() const { return buffer; }
+    const Stats& getStats() const { return stats; }
+
+private:
+    //A finished frame's region of the ring, it is free again once the fence has signaled
+    struct Region
+    {
+        GLsync fence;
+        size_t begin;
+        size_t end;
+        //Wrapped regions cover [begin, capacity) and [0, end)
+        bool wrapped;
+    };
+
+    //This finds where size bytes can go and waits for the GPU if that memory is still in use
+    size_t reserve(size_t size, size_t alignment);
+    //This fences the current frame's region and starts a new one at head
+    void fenceFrame();
+    bool overlapsInFlight(size_t begin, size_t end) const;
+    void waitForOldest();
+
+    unsigned int buffer = 0;
+    size_t capacity = 0;
+    //The whole ring's mapping when it is persistent, null otherwise
+    char* persistentMapping = nullptr;
+    size_t head = 0;
+    //Where the current frame's writes started, frames can wrap so begin may be past end
+    size_t frameBegin = 0;
+    bool frameWrapped = false;
+    std::deque<Region> inFlight;
+    //Running totals for the frame being recorded
+    size_t frameBytes = 0;
+    double frameWaitMs = 0.0;
+    unsigned int frameWaits = 0;
+    Stats stats;
+};
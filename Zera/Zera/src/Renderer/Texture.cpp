@@ -0,0 +1,57 @@
+#include "Renderer/Texture.h"
+#include "Renderer/GLCapabilities.h"
+#include "Renderer/GLStateCache.h"
+
+#include <glad/glad.h>
+
+#include <vector>
+
+unsigned int createTexture(int width, int height, const unsigned char* pixels)
+{
+    unsigned int texture;
+    //With direct state access the texture is set up without binding it, so the cached unit 0 binding stays valid
+    if (glCapabilities().directStateAccess)
+    {
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureStorage2D(texture, 1, GL_RGBA8, width, height);
+        glTextureSubImage2D(texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        return texture;
+    }
+
+    glGenTextures(1, &texture);
+    glState().bindTexture(0, GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    //Immutable storage lets the driver skip checking the texture is complete on every draw that samples it
+    if (glCapabilities().textureStorage)
+    {
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+    else
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+    glState().bindTexture(0, GL_TEXTURE_2D, 0);
+    return texture;
+}
+
+unsigned int createCheckerTexture(int size, unsigned int colorA, unsigned int colorB)
+{
+    //Packed colors are stored little endian so they land in memory as R, G, B, A
+    std::vector<unsigned int> pixels(size * size);
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            pixels[y * size + x] = ((x / 4 + y / 4) & 1) ? colorA : colorB;
+        }
+    }
+    return createTexture(size, size, reinterpret_cast<const unsigned char*>(pixels.data()));
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+//This uploads RGBA8 pixels into a new 2D texture and returns its ID
+unsigned int createTexture(int width, int height, const unsigned char* pixels);
+//This builds a size x size checkerboard texture out of two packed RGBA colors (0xAABBGGRR)
+unsigned int createCheckerTexture(int size, unsigned int colorA, unsigned int colorB);
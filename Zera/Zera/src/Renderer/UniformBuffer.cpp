@@ -0,0 +1,76 @@
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/GLStateCache.h"
+
+#include <glad/glad.h>
+
+//Block names in the same order as UniformBinding
+static const char* blockNames[UniformBindingCount] = { "FrameConstants", "ViewConstants", "MaterialConstants", "DrawConstants" };
+
+const std::string& uniformBlockSource()
+{
+    //Built from the C++ constants so the array size and attribute location can only be changed in one place
+    static const std::string source =
+        "#define DRAWS_PER_BLOCK " + std::to_string(drawsPerBlock) + "\n"
+        "#define DRAW_INDEX_LOCATION " + std::to_string(drawIndexLocation) + "\n"
+        "layout (std140) uniform FrameConstants\n"
+        "{\n"
+        "   float time;\n"
+        "   float deltaTime;\n"
+        "   vec2 resolution;\n"
+        "} frame;\n"
+        "layout (std140) uniform ViewConstants\n"
+        "{\n"
+        "   mat4 viewProjection;\n"
+        "} view;\n"
+        "layout (std140) uniform MaterialConstants\n"
+        "{\n"
+        "   vec4 color;\n"
+        "} material;\n"
+        "struct DrawData\n"
+        "{\n"
+        "   mat4 transform;\n"
+        "   vec4 color;\n"
+        "};\n"
+        "layout (std140) uniform DrawConstants\n"
+        "{\n"
+        "   DrawData draws[DRAWS_PER_BLOCK];\n"
+        "};\n";
+    return source;
+}
+
+std::string drawIndexSource(bool drawParameters)
+{
+    return std::string("layout (location = DRAW_INDEX_LOCATION) in uint aDrawIndex;\n") +
+        (drawParameters ? "#define DRAW_INDEX (aDrawIndex + uint(gl_DrawIDARB))\n" : "#define DRAW_INDEX aDrawIndex\n");
+}
+
+void bindUniformBlocks(unsigned int program)
+{
+    for (unsigned int binding = 0; binding < UniformBindingCount; binding++)
+    {
+        unsigned int index = glGetUniformBlockIndex(program, blockNames[binding]);
+        //Blocks the program never reads are optimized out and report GL_INVALID_INDEX
+        if (index != GL_INVALID_INDEX)
+        {
+            glUniformBlockBinding(program, index, binding);
+        }
+    }
+}
+
+bool UniformBuffer::init(size_t capacity)
+{
+    int offsetAlignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+    alignment = offsetAlignment > 0 ? (size_t)offsetAlignment : 256;
+    return stream.init(GL_UNIFORM_BUFFER, capacity);
+}
+
+void UniformBuffer::shutdown()
+{
+    stream.shutdown();
+}
+
+void UniformBuffer::bindRange(UniformBinding binding, size_t offset, size_t size)
+{
+    glState().bindUniformRange(binding, stream.getBuffer(), offset, size);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Renderer/StreamBuffer.h"
+
+#include <cstddef>
+#include <string>
+
+//Constant blocks shared by every shader. The structs mirror the std140 GLSL blocks in uniformBlockSource(),
+//so every member sits at a multiple of its std140 alignment and every struct is padded to 16 bytes. The
+//static_asserts below catch a member added on one side and not the other.
+enum UniformBinding
+{
+    FrameBinding = 0,
+    ViewBinding = 1,
+    MaterialBinding = 2,
+    DrawBinding = 3,
+    UniformBindingCount
+};
+
+//Once per frame
+struct FrameConstants
+{
+    float time;
+    float deltaTime;
+    float resolution[2];
+};
+static_assert(sizeof(FrameConstants) == 16, "FrameConstants must match the std140 FrameConstants block");
+static_assert(offsetof(FrameConstants, resolution) == 8, "vec2 resolution must be 8 byte aligned");
+
+//Once per view, each draw path (queue, instances, sprites) is its own view. Matrices are column major.
+struct ViewConstants
+{
+    float viewProjection[16];
+};
+static_assert(sizeof(ViewConstants) == 64, "ViewConstants must match the std140 ViewConstants block");
+
+//Once per material
+struct MaterialConstants
+{
+    float color[4];
+};
+static_assert(sizeof(MaterialConstants) == 16, "MaterialConstants must match the std140 MaterialConstants block");
+
+//Per draw, the transform is a column major 4x4 matrix. Draws are bound as an array of drawsPerBlock entries
+//and the vertex shader picks its entry with DRAW_INDEX, see drawIndexSource.
+struct DrawConstants
+{
+    float transform[16];
+    float color[4];
+};
+static_assert(sizeof(DrawConstants) == 80, "DrawConstants must match the std140 array stride of DrawData");
+static_assert(offsetof(DrawConstants, color) == 64, "vec4 color must follow mat4 transform");
+
+//128 draws is 10KB, well under the 16KB every GL 3.3 driver supports for one block
+const unsigned int drawsPerBlock = 128;
+//Generic attribute that carries the draw's index into the DrawConstants array. No VAO enables it, so the
+//value set with glVertexAttribI1ui is what every vertex sees.
+const unsigned int drawIndexLocation = 15;
+
+//GLSL declarations of the blocks above, the shader manager inserts them into every shader after #version
+const std::string& uniformBlockSource();
+//GLSL for vertex shaders that declares aDrawIndex and defines DRAW_INDEX, the entry of draws[] the draw reads.
+//With GL_ARB_shader_draw_parameters it is aDrawIndex + gl_DrawIDARB, so one glMultiDrawElementsBaseVertex can
+//cover consecutive entries with aDrawIndex set to the first. Without it DRAW_INDEX is aDrawIndex and every draw
+//of a multi draw reads the same entry. Goes after uniformBlockSource, which defines DRAW_INDEX_LOCATION.
+std::string drawIndexSource(bool drawParameters);
+//This points the blocks a linked program uses at their binding points, GLSL 330 cannot do it in the shader
+void bindUniformBlocks(unsigned int program);
+
+//The uniform buffer streams constants through one ring-buffered UBO. Every write is rounded up to
+//GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT so it can be bound on its own with glBindBufferRange, which replaces
+//setting uniforms one by one on every program that needs them.
+class UniformBuffer
+{
+public:
+    bool init(size_t capacity);
+    void shutdown();
+
+    //This copies the constants into the ring and binds them to the binding point
+    template <typename T>
+    void bind(UniformBinding binding, const T& constants)
+    {
+        size_t offset = stream.write(&constants, sizeof(T), alignment);
+        bindRange(binding, offset, sizeof(T));
+    }
+    //Lower level versions for writing many blocks at once and binding pieces of them
+    void* map(size_t size, size_t& offset) { return stream.map(size, alignment, offset); }
+    void unmap() { stream.unmap(); }
+    void bindRange(UniformBinding binding, size_t offset, size_t size);
+    //This fences the frame's constants, call it after the frame's draws
+    void endFrame() { stream.endFrame(); }
+
+    //Offsets of separately bound blocks inside one write have to be multiples of this
+    size_t getAlignment() const { return alignment; }
+    const StreamBuffer::Stats& getStats() const { return stream.getStats(); }
+
+private:
+    StreamBuffer stream;
+    size_t alignment = 256;
+};
@@ -0,0 +1,85 @@
+#include "Renderer/VertexLayout.h"
+#include "Renderer/GLStateCache.h"
+
+void enableVertexLayout(const VertexLayout& layout)
+{
+    for (unsigned int i = 0; i < layout.count; i++)
+    {
+        glEnableVertexAttribArray(layout.attributes[i].location);
+        glVertexAttribDivisor(layout.attributes[i].location, layout.divisor);
+    }
+}
+
+void pointVertexLayout(const VertexLayout& layout, size_t baseOffset)
+{
+    for (unsigned int i = 0; i < layout.count; i++)
+    {
+        const VertexAttribute& attribute = layout.attributes[i];
+        const void* pointer = (const void*)(baseOffset + attribute.offset);
+        if (attribute.integer)
+        {
+            glVertexAttribIPointer(attribute.location, attribute.components, attribute.type, layout.stride, pointer);
+        }
+        else
+        {
+            glVertexAttribPointer(attribute.location, attribute.components, attribute.type, attribute.normalized ? GL_TRUE : GL_FALSE, layout.stride, pointer);
+        }
+    }
+}
+
+unsigned int VertexArrayCache::get(const VertexLayout& layout, unsigned int vertexBuffer, unsigned int indexBuffer)
+{
+    Key key = { &layout, vertexBuffer, indexBuffer };
+    auto found = vertexArrays.find(key);
+    if (found != vertexArrays.end())
+    {
+        return found->second;
+    }
+
+    unsigned int vertexArray = 0;
+    glGenVertexArrays(1, &vertexArray);
+    glState().bindVertexArray(vertexArray);
+    glState().bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    if (indexBuffer)
+    {
+        glState().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    }
+    enableVertexLayout(layout);
+    pointVertexLayout(layout, 0);
+
+    //The EBO binding is part of the VAO so only the VAO gets unbound
+    glState().bindVertexArray(0);
+    vertexArrays[key] = vertexArray;
+    return vertexArray;
+}
+
+void VertexArrayCache::release(unsigned int buffer)
+{
+    for (auto entry = vertexArrays.begin(); entry != vertexArrays.end();)
+    {
+        if (entry->first.vertexBuffer == buffer || entry->first.indexBuffer == buffer)
+        {
+            glState().deleteVertexArray(entry->second);
+            entry = vertexArrays.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+void VertexArrayCache::shutdown()
+{
+    for (auto& entry : vertexArrays)
+    {
+        glState().deleteVertexArray(entry.second);
+    }
+    vertexArrays.clear();
+}
+
+VertexArrayCache& vertexArrays()
+{
+    static VertexArrayCache cache;
+    return cache;
+}
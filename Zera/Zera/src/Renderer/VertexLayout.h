@@ -0,0 +1,155 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+//Attribute locations are fixed per meaning, so any shader that reads a color reads it from the same location
+//and any layout with a color can feed it
+enum VertexSemantic
+{
+    PositionAttribute = 0,
+    TexCoordAttribute = 1,
+    ColorAttribute = 2,
+    //A mat4 per instance, one location per column
+    InstanceTransformAttribute = 3,
+    InstanceColorAttribute = 7,
+    NormalAttribute = 8,
+    TangentAttribute = 9
+};
+
+//Bytes one attribute takes in the vertex, packed formats hold all four components in one 32 bit word
+constexpr unsigned int vertexAttributeSize(GLenum type, int components)
+{
+    return type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV ? 4u :
+        type == GL_FLOAT || type == GL_INT || type == GL_UNSIGNED_INT ? 4u * components :
+        type == GL_HALF_FLOAT || type == GL_SHORT || type == GL_UNSIGNED_SHORT ? 2u * components :
+        type == GL_BYTE || type == GL_UNSIGNED_BYTE ? 1u * components : 0u;
+}
+
+//Alignment GL wants for the attribute's offset and the stride, the size of one component
+constexpr unsigned int vertexAttributeAlignment(GLenum type)
+{
+    return type == GL_HALF_FLOAT || type == GL_SHORT || type == GL_UNSIGNED_SHORT ? 2u :
+        type == GL_BYTE || type == GL_UNSIGNED_BYTE ? 1u : 4u;
+}
+
+struct VertexAttribute
+{
+    unsigned int location;
+    int components;
+    GLenum type;
+    //Normalized integers read as 0..1 (or -1..1) floats, integer attributes read as ints through glVertexAttribIPointer
+    bool normalized;
+    bool integer;
+    unsigned int offset;
+    unsigned int size;
+};
+
+constexpr VertexAttribute vertexAttribute(unsigned int location, int components, GLenum type, bool normalized, size_t offset)
+{
+    return VertexAttribute{ location, components, type, normalized, false, (unsigned int)offset, vertexAttributeSize(type, components) };
+}
+
+constexpr VertexAttribute integerVertexAttribute(unsigned int location, int components, GLenum type, size_t offset)
+{
+    return VertexAttribute{ location, components, type, false, true, (unsigned int)offset, vertexAttributeSize(type, components) };
+}
+
+//Shorthand that takes the offset from the vertex struct
+#define VERTEX_ATTRIBUTE(Vertex, member, location, components, type, normalized) \
+    vertexAttribute(location, components, type, normalized, offsetof(Vertex, member))
+
+//A vertex format, described once as a constexpr global next to the vertex struct it describes. The stride is
+//always sizeof the struct and isValid() demands the attributes cover it exactly, so a layout with a gap, an
+//overlap, a misaligned member or a member past the end fails its static_assert instead of drawing garbage.
+//Layouts are looked up by address, so using one costs nothing at runtime. Layouts shared between files must be
+//declared inline constexpr so every file sees the same address.
+struct VertexLayout
+{
+    static const unsigned int maxAttributes = 8;
+
+    unsigned int stride;
+    //0 for per vertex data, 1 to advance once per instance
+    unsigned int divisor;
+    unsigned int count;
+    VertexAttribute attributes[maxAttributes];
+
+    constexpr bool isValid() const
+    {
+        if (count == 0 || count > maxAttributes)
+        {
+            return false;
+        }
+        unsigned int covered = 0;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            const VertexAttribute& attribute = attributes[i];
+            if (attribute.size == 0 || attribute.offset + attribute.size > stride || attribute.offset % vertexAttributeAlignment(attribute.type) != 0)
+            {
+                return false;
+            }
+            for (unsigned int j = 0; j < i; j++)
+            {
+                const VertexAttribute& other = attributes[j];
+                bool overlaps = attribute.offset < other.offset + other.size && other.offset < attribute.offset + attribute.size;
+                if (overlaps || attribute.location == other.location)
+                {
+                    return false;
+                }
+            }
+            covered += attribute.size;
+        }
+        return covered == stride;
+    }
+};
+
+template <typename Vertex, typename... Attributes>
+constexpr VertexLayout makeVertexLayout(unsigned int divisor, Attributes... attributes)
+{
+    static_assert(sizeof...(Attributes) <= VertexLayout::maxAttributes, "too many attributes in one vertex layout");
+    return VertexLayout{ (unsigned int)sizeof(Vertex), divisor, (unsigned int)sizeof...(Attributes), { attributes... } };
+}
+
+//This enables the layout's attributes and sets their divisors on the bound VAO, once per VAO
+void enableVertexLayout(const VertexLayout& layout);
+//This points the layout's attributes at the bound GL_ARRAY_BUFFER, starting baseOffset bytes in
+void pointVertexLayout(const VertexLayout& layout, size_t baseOffset);
+
+//The VAO cache hands out one VAO per (layout, vertex buffer, index buffer), so every mesh or stream that shares
+//buffers and a format also shares the VAO that describes them. VAOs are created the first time a combination
+//is asked for and deleted when one of their buffers is released.
+class VertexArrayCache
+{
+public:
+    //This returns the VAO for the combination, creating and setting it up on first use. indexBuffer may be 0.
+    unsigned int get(const VertexLayout& layout, unsigned int vertexBuffer, unsigned int indexBuffer);
+    //This deletes every VAO that uses the buffer, call it before deleting the buffer
+    void release(unsigned int buffer);
+    void shutdown();
+
+private:
+    struct Key
+    {
+        const VertexLayout* layout;
+        unsigned int vertexBuffer;
+        unsigned int indexBuffer;
+        bool operator==(const Key& other) const { return layout == other.layout && vertexBuffer == other.vertexBuffer && indexBuffer == other.indexBuffer; }
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            size_t hash = std::hash<const void*>()(key.layout);
+            hash = hash * 31 + key.vertexBuffer;
+            return hash * 31 + key.indexBuffer;
+        }
+    };
+
+    std::unordered_map<Key, unsigned int, KeyHash> vertexArrays;
+};
+
+//VAOs belong to the one GL context, so the cache is global like the state cache
+VertexArrayCache& vertexArrays();
@@ -0,0 +1,114 @@
+#include "Renderer/VertexPacking.h"
+
+#include <cmath>
+#include <cstring>
+
+uint16_t packHalf(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+    uint32_t exponent = (bits >> 23) & 0xFF;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    //NaN keeps a mantissa bit so it stays NaN, infinity and anything too big for a half becomes infinity
+    if (exponent == 0xFF)
+    {
+        return sign | 0x7C00 | (mantissa ? 0x200 : 0);
+    }
+    int halfExponent = (int)exponent - 127 + 15;
+    if (halfExponent >= 31)
+    {
+        return sign | 0x7C00;
+    }
+
+    //Too small for a normal half, shift the mantissa down into a denormal and round to nearest even
+    if (halfExponent <= 0)
+    {
+        if (halfExponent < -10)
+        {
+            return sign;
+        }
+        mantissa |= 0x800000;
+        int shift = 14 - halfExponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t midpoint = 1u << (shift - 1);
+        if (remainder > midpoint || (remainder == midpoint && (half & 1)))
+        {
+            half++;
+        }
+        return sign | (uint16_t)half;
+    }
+
+    //Rounding can carry into the exponent, which is still the right answer, up to and including infinity
+    uint32_t half = ((uint32_t)halfExponent << 10) | (mantissa >> 13);
+    uint32_t remainder = mantissa & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+    {
+        half++;
+    }
+    return sign | (uint16_t)half;
+}
+
+int16_t packSnorm16(float value)
+{
+    value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    return (int16_t)std::lround(value * 32767.0f);
+}
+
+uint8_t packUnorm8(float value)
+{
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    return (uint8_t)std::lround(value * 255.0f);
+}
+
+void packOctahedral(const float normal[3], int16_t packed[2])
+{
+    float length = std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]);
+    if (length == 0.0f)
+    {
+        //A zero normal has no direction to keep, facing +Z is as good as any
+        packed[0] = packed[1] = 0;
+        return;
+    }
+    float x = normal[0] / length;
+    float y = normal[1] / length;
+    //The lower half of the octahedron is folded over the diagonals onto the corners of the square
+    if (normal[2] < 0.0f)
+    {
+        float foldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float foldedY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = foldedX;
+        y = foldedY;
+    }
+    packed[0] = packSnorm16(x);
+    packed[1] = packSnorm16(y);
+}
+
+uint32_t packTangent(const float tangent[4])
+{
+    uint32_t packed = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        float value = tangent[i] < -1.0f ? -1.0f : (tangent[i] > 1.0f ? 1.0f : tangent[i]);
+        int32_t component = (int32_t)std::lround(value * 511.0f);
+        packed |= ((uint32_t)component & 0x3FF) << (i * 10);
+    }
+    //The handedness is -1 or +1, anything else is taken by its sign
+    uint32_t handedness = tangent[3] < 0.0f ? 0x3u : 0x1u;
+    return packed | (handedness << 30);
+}
+
+const std::string& vertexDecodeSource()
+{
+    static const std::string source =
+        "vec3 decodeOctahedral(vec2 encoded)\n"
+        "{\n"
+        "   vec3 normal = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));\n"
+        "   float fold = max(-normal.z, 0.0);\n"
+        "   normal.xy += vec2(normal.x >= 0.0 ? -fold : fold, normal.y >= 0.0 ? -fold : fold);\n"
+        "   return normalize(normal);\n"
+        "}\n";
+    return source;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+//Conversions from the float data meshes are imported with into the packed formats they are stored in. Each
+//one matches how GL unpacks the attribute, so the shader reads back the nearest value the format can hold.
+
+//This rounds a float to the nearest IEEE half, out of range values become infinity
+uint16_t packHalf(float value);
+//This maps -1..1 onto a signed 16 bit normalized integer
+int16_t packSnorm16(float value);
+//This maps 0..1 onto an unsigned 8 bit normalized integer
+uint8_t packUnorm8(float value);
+//This folds a unit normal onto the octahedron and stores the two coordinates as snorm16, decodeOctahedral
+//in the shader unfolds it. Two components instead of three, off by under 0.005 degrees.
+void packOctahedral(const float normal[3], int16_t packed[2]);
+//This packs xyz into 10 bits each and the handedness into the top 2 bits for GL_INT_2_10_10_10_REV. GL 3.3
+//and later drivers disagree on how a 2 bit snorm unpacks, so shaders read the handedness with sign().
+uint32_t packTangent(const float tangent[4]);
+
+//GLSL helpers for packed attributes, put into every vertex shader after the shared uniform blocks
+const std::string& vertexDecodeSource();
@@ -0,0 +1,152 @@
+#include "Scenes/ChurnStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/Texture.h"
+#include "Scenes/StressContent.h"
+
+#include <cstdlib>
+#include <string>
+
+ChurnStressScene::ChurnStressScene(int objectCount)
+    : objectCount(objectCount)
+{
+}
+
+bool ChurnStressScene::init(Renderer& renderer)
+{
+    for (int i = 0; i < programCount; i++)
+    {
+        std::string defines = "#define VARIANT " + std::to_string(i) + "\n";
+        std::string name = "stress churn " + std::to_string(i);
+        programs[i] = shaderManager().submit(name.c_str(), stressVertexShaderSource, stressFragmentShaderSource, defines.c_str());
+        if (!programs[i])
+        {
+            return false;
+        }
+    }
+
+    //Each texture gets its own checker colors, picked from the index so the set is the same every run
+    for (int i = 0; i < textureCount; i++)
+    {
+        unsigned int r = 0x80 + (i * 37) % 0x80;
+        unsigned int g = 0x80 + (i * 71) % 0x80;
+        unsigned int b = 0x80 + (i * 113) % 0x80;
+        textures[i] = createCheckerTexture(8 << (i % 3), 0xFF000000u | (b << 16) | (g << 8) | r, 0xFF404040u);
+    }
+
+    ProceduralMesh square = makePolygon(4, 0.0f);
+    ProceduralMesh star = makePolygon(10, 0.5f);
+    meshes[0] = createMesh(square.data());
+    meshes[1] = createMesh(star.data());
+    for (int i = 0; i < programCount; i++)
+    {
+        if (!shaderManager().validateVertexInputs(programs[i], meshes[0].VAO, "churn square") ||
+            !shaderManager().validateVertexInputs(programs[i], meshes[1].VAO, "churn star"))
+        {
+            return false;
+        }
+    }
+
+    objects.resize(objectCount);
+    for (Object& object : objects)
+    {
+        object.x = (rand() % 2000) / 1000.0f - 1.0f;
+        object.y = (rand() % 2000) / 1000.0f - 1.0f;
+        object.depth = 0.01f + (rand() % 980) / 1000.0f;
+        object.previousDepth = object.depth;
+        object.drift = (rand() % 200) / 1000.0f - 0.1f;
+        object.scale = 0.02f + (rand() % 30) / 1000.0f;
+        object.color[0] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[1] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[2] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[3] = 0.35f + (rand() % 40) / 100.0f;
+        object.program = (unsigned char)(rand() % programCount);
+        object.texture = (unsigned char)(rand() % textureCount);
+        object.mesh = (unsigned char)(rand() % meshCount);
+    }
+    stats.objects = (unsigned int)objectCount;
+    return true;
+}
+
+void ChurnStressScene::update(float step, int width, int height)
+{
+    //Depths bounce between the near and far planes so the back to front order keeps reshuffling
+    for (Object& object : objects)
+    {
+        object.previousDepth = object.depth;
+        object.depth += object.drift * step;
+        if (object.depth < 0.01f || object.depth > 0.99f)
+        {
+            object.drift = -object.drift;
+            object.depth = object.depth < 0.01f ? 0.01f : 0.99f;
+        }
+    }
+}
+
+void ChurnStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    RenderQueue& queue = buffer.queue;
+
+    float aspect = (float)buffer.height / (float)buffer.width;
+    float viewProjection[16] = {};
+    viewProjection[0] = aspect;
+    viewProjection[5] = 1.0f;
+    viewProjection[10] = 1.0f;
+    viewProjection[15] = 1.0f;
+    queue.setViewProjection(viewProjection);
+
+    //One material per texture, so a texture change is a material change as well
+    unsigned int materials[textureCount];
+    for (int i = 0; i < textureCount; i++)
+    {
+        float tint = 0.8f + 0.2f * (i % 2);
+        materials[i] = queue.addMaterial({ { tint, 1.0f, tint, 1.0f } });
+    }
+
+    const GeometryRange ranges[meshCount] = { getMeshRange(meshes[0]), getMeshRange(meshes[1]) };
+    RenderCommand command = {};
+    DrawConstants constants = {};
+    for (const Object& object : objects)
+    {
+        float depth = object.previousDepth + (object.depth - object.previousDepth) * alpha;
+        constants.transform[0] = object.scale;
+        constants.transform[5] = object.scale;
+        constants.transform[10] = 1.0f;
+        constants.transform[12] = object.x / aspect;
+        constants.transform[13] = object.y;
+        constants.transform[14] = depth * 2.0f - 1.0f;
+        constants.transform[15] = 1.0f;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            constants.color[channel] = object.color[channel];
+        }
+
+        command.sortKey = SortKey::translucent(0, object.program, object.texture, depth);
+        command.program = programs[object.program];
+        command.texture = textures[object.texture];
+        command.material = materials[object.texture];
+        command.vertexArray = meshes[object.mesh].VAO;
+        command.indexCount = meshes[object.mesh].indexCount;
+        command.firstIndex = ranges[object.mesh].firstIndex;
+        command.baseVertex = ranges[object.mesh].baseVertex;
+        queue.push(command, constants);
+    }
+}
+
+void ChurnStressScene::shutdown(Renderer& renderer)
+{
+    for (int i = 0; i < programCount; i++)
+    {
+        shaderManager().release(programs[i]);
+    }
+    for (int i = 0; i < textureCount; i++)
+    {
+        glState().deleteTexture(textures[i]);
+    }
+    for (int i = 0; i < meshCount; i++)
+    {
+        destroyMesh(meshes[i]);
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+#include "Renderer/Mesh.h"
+
+#include <vector>
+
+//Worst case state churn: every object is translucent, so the queue has to sort back to front, and objects pick
+//their program, texture and mesh at random from many of each. Neighbours in the sorted order almost never share
+//state, so nearly every draw rebinds something and batching has nothing to merge. Depths drift every step so the
+//order is different each frame.
+class ChurnStressScene : public Scene
+{
+public:
+    explicit ChurnStressScene(int objectCount);
+
+    const char* getName() const override { return "churn"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    static const int programCount = 16;
+    static const int textureCount = 32;
+    static const int meshCount = 2;
+
+    struct Object
+    {
+        float x, y;
+        float depth, drift;
+        //The depth a step ago, record interpolates from here
+        float previousDepth;
+        float scale;
+        float color[4];
+        unsigned char program;
+        unsigned char texture;
+        unsigned char mesh;
+    };
+
+    int objectCount;
+    std::vector<Object> objects;
+    unsigned int programs[programCount] = {};
+    unsigned int textures[textureCount] = {};
+    Mesh meshes[meshCount];
+};
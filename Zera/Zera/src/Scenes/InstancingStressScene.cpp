@@ -0,0 +1,103 @@
+#include "Scenes/InstancingStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/Renderer.h"
+
+#include <cmath>
+#include <cstdlib>
+
+InstancingStressScene::InstancingStressScene(int instanceCount)
+    : instanceCount(instanceCount)
+{
+}
+
+bool InstancingStressScene::init(Renderer& renderer)
+{
+    //The same rectangle main draws, plus a triangle so the scene has two meshes to group
+    const float rectangleVertices[] = {
+     0.5f,  0.5f, 0.0f,
+     0.5f, -0.5f, 0.0f,
+    -0.5f, -0.5f, 0.0f,
+    -0.5f,  0.5f, 0.0f
+    };
+    const unsigned int rectangleIndices[] = { 0, 1, 3, 1, 2, 3 };
+    const float triangleVertices[] = {
+     0.0f,  0.5f, 0.0f,
+     0.5f, -0.5f, 0.0f,
+    -0.5f, -0.5f, 0.0f
+    };
+    const unsigned int triangleIndices[] = { 0, 1, 2 };
+    rectangle = createMesh(rectangleVertices, 4, rectangleIndices, 6);
+    triangle = createMesh(triangleVertices, 3, triangleIndices, 3);
+    InstancedRenderer& instancedRenderer = renderer.getInstancedRenderer();
+    if (!instancedRenderer.addMesh(rectangle, "instancing rectangle") || !instancedRenderer.addMesh(triangle, "instancing triangle"))
+    {
+        return false;
+    }
+
+    objects.resize(instanceCount);
+    for (Object& object : objects)
+    {
+        object.x = (rand() % 2000) / 1000.0f - 1.0f;
+        object.y = (rand() % 2000) / 1000.0f - 1.0f;
+        object.angle = (rand() % 628) / 100.0f;
+        object.previousAngle = object.angle;
+        object.spin = (rand() % 400) / 100.0f - 2.0f;
+        object.scale = 0.01f + (rand() % 30) / 1000.0f;
+        object.color[0] = (rand() % 256) / 255.0f;
+        object.color[1] = (rand() % 256) / 255.0f;
+        object.color[2] = (rand() % 256) / 255.0f;
+        object.color[3] = 1.0f;
+    }
+    stats.objects = (unsigned int)instanceCount;
+    return true;
+}
+
+void InstancingStressScene::update(float step, int width, int height)
+{
+    for (Object& object : objects)
+    {
+        object.previousAngle = object.angle;
+        object.angle += object.spin * step;
+    }
+}
+
+void InstancingStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    //The objects live in clip space, so the view projection only corrects for the aspect ratio
+    float viewProjection[16] = {};
+    viewProjection[0] = (float)buffer.height / (float)buffer.width;
+    viewProjection[5] = 1.0f;
+    viewProjection[10] = 1.0f;
+    viewProjection[15] = 1.0f;
+    InstanceBatch& batch = buffer.instances;
+    batch.begin(viewProjection);
+
+    //Meshes alternate on purpose, grouping happens inside the renderer rather than in the scene
+    InstanceData instance = {};
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        const Object& object = objects[i];
+        float angle = object.previousAngle + (object.angle - object.previousAngle) * alpha;
+        float c = cosf(angle) * object.scale;
+        float s = sinf(angle) * object.scale;
+        instance.transform[0] = c;
+        instance.transform[1] = s;
+        instance.transform[4] = -s;
+        instance.transform[5] = c;
+        instance.transform[10] = object.scale;
+        instance.transform[12] = object.x;
+        instance.transform[13] = object.y;
+        instance.transform[15] = 1.0f;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            instance.color[channel] = object.color[channel];
+        }
+        batch.submit((i & 1) ? triangle : rectangle, instance);
+    }
+}
+
+void InstancingStressScene::shutdown(Renderer& renderer)
+{
+    destroyMesh(rectangle);
+    destroyMesh(triangle);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+#include "Renderer/Mesh.h"
+
+#include <vector>
+
+//Spins a crowd of rectangles and triangles submitted in mixed order, the instanced renderer groups them into one draw per mesh
+class InstancingStressScene : public Scene
+{
+public:
+    explicit InstancingStressScene(int instanceCount);
+
+    const char* getName() const override { return "instancing"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    struct Object
+    {
+        float x, y;
+        float angle;
+        //The angle a step ago, record interpolates from here
+        float previousAngle;
+        float spin;
+        float scale;
+        float color[4];
+    };
+
+    int instanceCount;
+    std::vector<Object> objects;
+    Mesh rectangle;
+    Mesh triangle;
+};
@@ -0,0 +1,82 @@
+#include "Scenes/LightStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/Texture.h"
+#include "Scenes/StressContent.h"
+
+#include <string>
+
+LightStressScene::LightStressScene(int lightCount)
+    : lightCount(lightCount)
+{
+}
+
+bool LightStressScene::init(Renderer& renderer)
+{
+    std::string defines = "#define VARIANT 0\n#define LIGHT_COUNT " + std::to_string(lightCount) + "\n";
+    std::string name = "stress " + std::to_string(lightCount) + " lights";
+    program = shaderManager().submit(name.c_str(), stressVertexShaderSource, stressFragmentShaderSource, defines.c_str());
+    if (!program)
+    {
+        return false;
+    }
+    texture = createCheckerTexture(16, 0xFFFFFFFFu, 0xFFB0B0B0u);
+
+    //The rippled grid gives the lights normals to play over, its triangle count hardly matters next to the shading
+    ProceduralMesh geometry = makeGrid(64, 64);
+    surface = createMesh(geometry.data());
+    if (!shaderManager().validateVertexInputs(program, surface.VAO, "stress light surface"))
+    {
+        return false;
+    }
+    stats.objects = (unsigned int)lightCount;
+    return true;
+}
+
+void LightStressScene::update(float step, int width, int height)
+{
+    //The lights move in the shader, all there is to step is their clock
+    previousTime = time;
+    time += step;
+}
+
+void LightStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    RenderQueue& queue = buffer.queue;
+
+    float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    queue.setViewProjection(identity);
+
+    //The grid spans -0.5..0.5, scaled by 2 it fills clip space and so the whole window
+    DrawConstants constants = {};
+    constants.transform[0] = 2.0f;
+    constants.transform[5] = 2.0f;
+    constants.transform[10] = 1.0f;
+    constants.transform[15] = 1.0f;
+    for (int channel = 0; channel < 3; channel++)
+    {
+        constants.color[channel] = 1.0f;
+    }
+    constants.color[3] = previousTime + (time - previousTime) * alpha;
+
+    GeometryRange range = getMeshRange(surface);
+    RenderCommand command = {};
+    command.sortKey = SortKey::opaque(0, 0, 0, 0.5f);
+    command.program = program;
+    command.texture = texture;
+    command.material = queue.addMaterial({ { 1.0f, 1.0f, 1.0f, 1.0f } });
+    command.vertexArray = surface.VAO;
+    command.indexCount = surface.indexCount;
+    command.firstIndex = range.firstIndex;
+    command.baseVertex = range.baseVertex;
+    queue.push(command, constants);
+}
+
+void LightStressScene::shutdown(Renderer& renderer)
+{
+    shaderManager().release(program);
+    glState().deleteTexture(texture);
+    destroyMesh(surface);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+#include "Renderer/Mesh.h"
+
+//Covers the window with a lit surface and evaluates lightCount moving point lights for every pixel, forward
+//shading with no light culling, so the cost grows with lights times pixels and shows where that stops scaling.
+//The lights are placed and animated inside the fragment shader from their index and the simulation time, which
+//rides in the draw color's alpha since the surface is opaque. The count is compiled in as LIGHT_COUNT.
+class LightStressScene : public Scene
+{
+public:
+    explicit LightStressScene(int lightCount);
+
+    const char* getName() const override { return "lights"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    int lightCount;
+    unsigned int program = 0;
+    unsigned int texture = 0;
+    Mesh surface;
+    //Seconds of simulation at the last step and the one before, record interpolates between them
+    float time = 0.0f;
+    float previousTime = 0.0f;
+};
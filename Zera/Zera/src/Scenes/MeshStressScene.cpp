@@ -0,0 +1,121 @@
+#include "Scenes/MeshStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/Texture.h"
+#include "Scenes/StressContent.h"
+
+#include <cmath>
+#include <cstdlib>
+
+MeshStressScene::MeshStressScene(int meshCount)
+    : meshCount(meshCount)
+{
+}
+
+bool MeshStressScene::init(Renderer& renderer)
+{
+    program = shaderManager().submit("stress meshes", stressVertexShaderSource, stressFragmentShaderSource, "#define VARIANT 0\n");
+    if (!program)
+    {
+        return false;
+    }
+    texture = createCheckerTexture(16, 0xFFFFFFFFu, 0xFF505050u);
+
+    //The objects fill a square grid, one cell each, so every mesh stays visible whatever the count
+    int columns = (int)std::ceil(std::sqrt((double)meshCount));
+    float cell = 2.0f / columns;
+    objects.resize(meshCount);
+    for (int i = 0; i < meshCount; i++)
+    {
+        Object& object = objects[i];
+        //Every mesh differs in its corner count, its ripple or both, 3 to 34 corners
+        ProceduralMesh geometry = makePolygon(3 + i % 32, (rand() % 60) / 100.0f);
+        object.mesh = createMesh(geometry.data());
+        object.x = -1.0f + cell * (i % columns + 0.5f);
+        object.y = -1.0f + cell * (i / columns + 0.5f);
+        object.depth = 0.01f + (rand() % 980) / 1000.0f;
+        object.angle = (rand() % 628) / 100.0f;
+        object.previousAngle = object.angle;
+        object.spin = (rand() % 400) / 100.0f - 2.0f;
+        object.scale = cell * 0.9f;
+        object.color[0] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[1] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[2] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[3] = 1.0f;
+    }
+    if (!objects.empty() && !shaderManager().validateVertexInputs(program, objects[0].mesh.VAO, "stress mesh"))
+    {
+        return false;
+    }
+    stats.objects = (unsigned int)meshCount;
+    return true;
+}
+
+void MeshStressScene::update(float step, int width, int height)
+{
+    for (Object& object : objects)
+    {
+        object.previousAngle = object.angle;
+        object.angle += object.spin * step;
+    }
+}
+
+void MeshStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    RenderQueue& queue = buffer.queue;
+
+    float aspect = (float)buffer.height / (float)buffer.width;
+    float viewProjection[16] = {};
+    viewProjection[0] = aspect;
+    viewProjection[5] = 1.0f;
+    viewProjection[10] = 1.0f;
+    viewProjection[15] = 1.0f;
+    queue.setViewProjection(viewProjection);
+    unsigned int material = queue.addMaterial({ { 1.0f, 1.0f, 1.0f, 1.0f } });
+
+    RenderCommand command = {};
+    DrawConstants constants = {};
+    command.program = program;
+    command.texture = texture;
+    command.material = material;
+    for (const Object& object : objects)
+    {
+        float angle = object.previousAngle + (object.angle - object.previousAngle) * alpha;
+        float c = cosf(angle) * object.scale;
+        float s = sinf(angle) * object.scale;
+        constants.transform[0] = c;
+        constants.transform[1] = s;
+        constants.transform[4] = -s;
+        constants.transform[5] = c;
+        constants.transform[10] = 1.0f;
+        constants.transform[12] = object.x / aspect;
+        constants.transform[13] = object.y;
+        constants.transform[14] = object.depth * 2.0f - 1.0f;
+        constants.transform[15] = 1.0f;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            constants.color[channel] = object.color[channel];
+        }
+
+        //Every mesh has its own range, looked up per object because there is nothing to share
+        GeometryRange range = getMeshRange(object.mesh);
+        command.sortKey = SortKey::opaque(0, 0, 0, object.depth);
+        command.vertexArray = object.mesh.VAO;
+        command.indexCount = object.mesh.indexCount;
+        command.firstIndex = range.firstIndex;
+        command.baseVertex = range.baseVertex;
+        queue.push(command, constants);
+    }
+}
+
+void MeshStressScene::shutdown(Renderer& renderer)
+{
+    shaderManager().release(program);
+    glState().deleteTexture(texture);
+    for (Object& object : objects)
+    {
+        destroyMesh(object.mesh);
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+#include "Renderer/Mesh.h"
+
+#include <vector>
+
+//Draws every object with its own procedurally generated mesh through the render queue, so nothing can be
+//instanced and the only sharing left is the geometry pool page, which is what multi draw batching leans on
+class MeshStressScene : public Scene
+{
+public:
+    explicit MeshStressScene(int meshCount);
+
+    const char* getName() const override { return "meshes"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    struct Object
+    {
+        float x, y, depth;
+        float angle, spin;
+        //The angle a step ago, record interpolates from here
+        float previousAngle;
+        float scale;
+        float color[4];
+        Mesh mesh;
+    };
+
+    int meshCount;
+    std::vector<Object> objects;
+    unsigned int program = 0;
+    unsigned int texture = 0;
+};
@@ -0,0 +1,240 @@
+#include "Scenes/QueueStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/Texture.h"
+#include "Scenes/StressContent.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+//Queue vertex shader, the meshes are packed so the normal arrives octahedral encoded. Transform and color come
+//from the draw's entry in the DrawConstants block, which DRAW_INDEX finds even inside a multi draw
+static const char* queueVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec2 aUV;\n"
+"layout (location = 2) in vec4 aColor;\n"
+"layout (location = 8) in vec2 aNormal;\n"
+"out vec2 vUV;\n"
+"out vec4 vColor;\n"
+"void main()\n"
+"{\n"
+"   DrawData draw = draws[DRAW_INDEX];\n"
+"   vec3 normal = mat3(draw.transform) * decodeOctahedral(aNormal);\n"
+"   float light = 0.65 + 0.35 * max(dot(normalize(normal), vec3(-0.36, 0.48, 0.8)), 0.0);\n"
+"   vUV = aUV;\n"
+"   vColor = draw.color * material.color * aColor * vec4(vec3(light), 1.0);\n"
+"   gl_Position = view.viewProjection * draw.transform * vec4(aPos, 1.0);\n"
+"}\0";
+//Queue fragment shader, VARIANT is defined per program so each one is a different shader to the driver
+static const char* queueFragmentShaderSource = "#version 330 core\n"
+"in vec2 vUV;\n"
+"in vec4 vColor;\n"
+"uniform sampler2D uTexture;\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"   vec4 texel = texture(uTexture, vUV);\n"
+"   FragColor = vec4(texel.rgb * (1.0 - 0.15 * float(VARIANT)), texel.a) * vColor;\n"
+"}\n\0";
+
+QueueStressScene::QueueStressScene(int commandCount)
+    : commandCount(commandCount)
+{
+}
+
+bool QueueStressScene::init(Renderer& renderer)
+{
+    for (int i = 0; i < programCount; i++)
+    {
+        std::string defines = "#define VARIANT " + std::to_string(i) + "\n";
+        std::string name = "queue variant " + std::to_string(i);
+        programs[i] = shaderManager().submit(name.c_str(), queueVertexShaderSource, queueFragmentShaderSource, defines.c_str());
+        if (!programs[i])
+        {
+            return false;
+        }
+    }
+
+    const unsigned int checkerColors[textureCount] = { 0xFFFFFFFFu, 0xFF80FFFFu, 0xFFFFFF80u, 0xFFFF80FFu };
+    for (int i = 0; i < textureCount; i++)
+    {
+        textures[i] = createCheckerTexture(16, checkerColors[i], 0xFF404040u);
+    }
+
+    //The meshes carry UVs, colors and normals bent outwards at the corners like a pillow, all of it packed at import
+    const float rectangleVertices[] = { 0.5f, 0.5f, 0.0f, 0.5f, -0.5f, 0.0f, -0.5f, -0.5f, 0.0f, -0.5f, 0.5f, 0.0f };
+    const float rectangleUVs[] = { 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    const float rectangleColors[] = { 1.0f, 1.0f, 1.0f, 1.0f, 0.85f, 0.85f, 0.85f, 1.0f, 0.7f, 0.7f, 0.7f, 1.0f, 0.85f, 0.85f, 0.85f, 1.0f };
+    const unsigned int rectangleIndices[] = { 0, 1, 3, 1, 2, 3 };
+    const float triangleVertices[] = { 0.0f, 0.5f, 0.0f, 0.5f, -0.5f, 0.0f, -0.5f, -0.5f, 0.0f };
+    const float triangleUVs[] = { 0.5f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f };
+    const float triangleColors[] = { 1.0f, 1.0f, 1.0f, 1.0f, 0.8f, 0.8f, 0.8f, 1.0f, 0.8f, 0.8f, 0.8f, 1.0f };
+    const unsigned int triangleIndices[] = { 0, 1, 2 };
+    float rectangleNormals[4 * 3];
+    float triangleNormals[3 * 3];
+    pillowNormals(rectangleVertices, 4, rectangleNormals);
+    pillowNormals(triangleVertices, 3, triangleNormals);
+
+    MeshData rectangle;
+    rectangle.positions = rectangleVertices;
+    rectangle.texCoords = rectangleUVs;
+    rectangle.normals = rectangleNormals;
+    rectangle.colors = rectangleColors;
+    rectangle.vertexCount = 4;
+    rectangle.indices = rectangleIndices;
+    rectangle.indexCount = 6;
+    MeshData triangle;
+    triangle.positions = triangleVertices;
+    triangle.texCoords = triangleUVs;
+    triangle.normals = triangleNormals;
+    triangle.colors = triangleColors;
+    triangle.vertexCount = 3;
+    triangle.indices = triangleIndices;
+    triangle.indexCount = 3;
+    meshes[0] = createMesh(rectangle);
+    meshes[1] = createMesh(triangle);
+    for (int i = 0; i < programCount; i++)
+    {
+        if (!shaderManager().validateVertexInputs(programs[i], meshes[0].VAO, "queue rectangle") ||
+            !shaderManager().validateVertexInputs(programs[i], meshes[1].VAO, "queue triangle"))
+        {
+            return false;
+        }
+    }
+
+    //Objects are created in random order on purpose, the queue is what puts them back together
+    objects.resize(commandCount);
+    for (Object& object : objects)
+    {
+        object.x = (rand() % 2000) / 1000.0f - 1.0f;
+        object.y = (rand() % 2000) / 1000.0f - 1.0f;
+        object.depth = 0.01f + (rand() % 980) / 1000.0f;
+        object.angle = (rand() % 628) / 100.0f;
+        object.previousAngle = object.angle;
+        object.spin = (rand() % 400) / 100.0f - 2.0f;
+        object.scale = 0.01f + (rand() % 20) / 1000.0f;
+        object.translucent = (rand() % 10) == 0;
+        object.color[0] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[1] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[2] = 0.5f + (rand() % 128) / 255.0f;
+        object.color[3] = object.translucent ? 0.5f : 1.0f;
+        object.program = (unsigned char)(rand() % programCount);
+        object.texture = (unsigned char)(rand() % textureCount);
+        object.mesh = (unsigned char)(rand() % 2);
+    }
+    stats.objects = (unsigned int)commandCount;
+
+    benchmarkSort();
+    return true;
+}
+
+void QueueStressScene::benchmarkSort()
+{
+    std::vector<SortItem> items(objects.size());
+    std::vector<SortItem> scratch(objects.size());
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        const Object& object = objects[i];
+        items[i].key = object.translucent ? SortKey::translucent(0, object.program, object.texture, object.depth) : SortKey::opaque(0, object.program, object.texture, object.depth);
+        items[i].index = (uint32_t)i;
+    }
+    std::vector<SortItem> copy = items;
+
+    auto start = std::chrono::steady_clock::now();
+    radixSort(items.data(), scratch.data(), items.size());
+    double radixMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    std::sort(copy.begin(), copy.end(), [](const SortItem& a, const SortItem& b) { return a.key < b.key; });
+    double comparisonMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "RenderQueue: sorted " << items.size() << " commands, radix " << radixMs << " ms, std::sort " << comparisonMs << " ms" << std::endl;
+}
+
+void QueueStressScene::update(float step, int width, int height)
+{
+    for (Object& object : objects)
+    {
+        object.previousAngle = object.angle;
+        object.angle += object.spin * step;
+    }
+}
+
+void QueueStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    //Sorting and submission happen when the renderer executes the buffer
+    RenderQueue& queue = buffer.queue;
+
+    //The aspect correction is shared by every draw, so it lives in the view block instead of each transform
+    float aspect = (float)buffer.height / (float)buffer.width;
+    float viewProjection[16] = {};
+    viewProjection[0] = aspect;
+    viewProjection[5] = 1.0f;
+    viewProjection[10] = 1.0f;
+    viewProjection[15] = 1.0f;
+    queue.setViewProjection(viewProjection);
+
+    //One material per texture, a slight tint on top of the texture's own colors
+    const float tints[textureCount][4] = { { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 0.9f, 0.9f, 1.0f }, { 0.9f, 1.0f, 0.9f, 1.0f }, { 0.9f, 0.9f, 1.0f, 1.0f } };
+    unsigned int materials[textureCount];
+    for (int i = 0; i < textureCount; i++)
+    {
+        MaterialConstants material = { { tints[i][0], tints[i][1], tints[i][2], tints[i][3] } };
+        materials[i] = queue.addMaterial(material);
+    }
+
+    //Where the meshes sit in the geometry pool is looked up once per frame rather than once per object
+    const GeometryRange ranges[2] = { getMeshRange(meshes[0]), getMeshRange(meshes[1]) };
+    RenderCommand command = {};
+    DrawConstants constants = {};
+    for (const Object& object : objects)
+    {
+        float angle = object.previousAngle + (object.angle - object.previousAngle) * alpha;
+        float c = cosf(angle) * object.scale;
+        float s = sinf(angle) * object.scale;
+        constants.transform[0] = c;
+        constants.transform[1] = s;
+        constants.transform[4] = -s;
+        constants.transform[5] = c;
+        constants.transform[10] = 1.0f;
+        //Divided by the aspect so the view's x scale puts objects back across the whole width
+        constants.transform[12] = object.x / aspect;
+        constants.transform[13] = object.y;
+        //Clip space z, so the depth test agrees with the depth baked into the key
+        constants.transform[14] = object.depth * 2.0f - 1.0f;
+        constants.transform[15] = 1.0f;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            constants.color[channel] = object.color[channel];
+        }
+
+        command.sortKey = object.translucent ? SortKey::translucent(0, object.program, object.texture, object.depth) : SortKey::opaque(0, object.program, object.texture, object.depth);
+        command.program = programs[object.program];
+        command.texture = textures[object.texture];
+        command.material = materials[object.texture];
+        command.vertexArray = meshes[object.mesh].VAO;
+        command.indexCount = meshes[object.mesh].indexCount;
+        command.firstIndex = ranges[object.mesh].firstIndex;
+        command.baseVertex = ranges[object.mesh].baseVertex;
+        queue.push(command, constants);
+    }
+}
+
+void QueueStressScene::shutdown(Renderer& renderer)
+{
+    for (int i = 0; i < programCount; i++)
+    {
+        shaderManager().release(programs[i]);
+    }
+    for (int i = 0; i < textureCount; i++)
+    {
+        glState().deleteTexture(textures[i]);
+    }
+    destroyMesh(meshes[0]);
+    destroyMesh(meshes[1]);
+}
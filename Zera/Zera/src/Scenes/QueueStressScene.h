@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/RenderQueue.h"
+
+#include <vector>
+
+//Pushes one render command per object through the sort key render queue, with a mix of shaders,
+//textures, depths and translucency, to measure how sorting and submission hold up at 100k commands
+class QueueStressScene : public Scene
+{
+public:
+    explicit QueueStressScene(int commandCount);
+
+    const char* getName() const override { return "queue"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    static const int programCount = 4;
+    static const int textureCount = 4;
+
+    struct Object
+    {
+        float x, y, depth;
+        float angle, spin;
+        //The angle a step ago, record interpolates from here
+        float previousAngle;
+        float scale;
+        float color[4];
+        unsigned char program;
+        unsigned char texture;
+        unsigned char mesh;
+        bool translucent;
+    };
+
+    //This times the radix sort against std::sort on the scene's keys once, so the log shows what sorting costs
+    void benchmarkSort();
+
+    int commandCount;
+    std::vector<Object> objects;
+    unsigned int programs[programCount] = {};
+    unsigned int textures[textureCount] = {};
+    Mesh meshes[2];
+};
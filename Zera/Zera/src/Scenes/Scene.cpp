@@ -0,0 +1,45 @@
+#include "Scenes/Scene.h"
+#include "Scenes/ChurnStressScene.h"
+#include "Scenes/InstancingStressScene.h"
+#include "Scenes/LightStressScene.h"
+#include "Scenes/MeshStressScene.h"
+#include "Scenes/QueueStressScene.h"
+#include "Scenes/SpriteStressScene.h"
+#include "Scenes/TriangleStressScene.h"
+
+#include <cstring>
+
+const char* const sceneNames = "sprites instancing queue meshes triangles lights churn";
+
+Scene* createScene(const char* name, int count)
+{
+    if (strcmp(name, "sprites") == 0)
+    {
+        return new SpriteStressScene(count > 0 ? count : 50000);
+    }
+    if (strcmp(name, "instancing") == 0)
+    {
+        return new InstancingStressScene(count > 0 ? count : 20000);
+    }
+    if (strcmp(name, "queue") == 0)
+    {
+        return new QueueStressScene(count > 0 ? count : 100000);
+    }
+    if (strcmp(name, "meshes") == 0)
+    {
+        return new MeshStressScene(count > 0 ? count : 2000);
+    }
+    if (strcmp(name, "triangles") == 0)
+    {
+        return new TriangleStressScene(count > 0 ? count : 1000000);
+    }
+    if (strcmp(name, "lights") == 0)
+    {
+        return new LightStressScene(count > 0 ? count : 64);
+    }
+    if (strcmp(name, "churn") == 0)
+    {
+        return new ChurnStressScene(count > 0 ? count : 20000);
+    }
+    return nullptr;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+struct CommandBuffer;
+class Renderer;
+
+//Numbers a scene reports back so main can print them next to the renderer's stats
+struct SceneStats
+{
+    unsigned int objects = 0;
+};
+
+//A scene owns its GL resources and records its draws every frame, stress scenes are picked with --scene on
+//the command line. init and shutdown run with the GL context current on the calling thread. shutdown also runs
+//after a failed init, so it must cope with resources init never got to (their handles are still 0). update and
+//record run on the main thread while the render thread may be drawing the previous frame, so they must not
+//touch GL, everything they want drawn goes into the command buffer.
+//update advances the simulation by one fixed step and may run any number of times a frame (see FixedTimestep).
+//record draws the state alpha of the way from the step before the last one to the last one, so motion stays
+//smooth when the frame rate and the step rate do not line up.
+class Scene
+{
+public:
+    virtual ~Scene() {}
+
+    virtual const char* getName() const = 0;
+    virtual bool init(Renderer& renderer) = 0;
+    virtual void update(float step, int width, int height) = 0;
+    virtual void record(CommandBuffer& buffer, float alpha) = 0;
+    virtual void shutdown(Renderer& renderer) = 0;
+
+    const SceneStats& getStats() const { return stats; }
+
+protected:
+    SceneStats stats;
+};
+
+//The names createScene knows, space separated
+extern const char* const sceneNames;
+
+//This creates the scene with the given name, count is the number of objects it should stress with (0 uses the scene default).
+//For triangles the count is triangles in one mesh and for lights it is lights.
+Scene* createScene(const char* name, int count);
@@ -0,0 +1,85 @@
+#include "Scenes/SpriteStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/Texture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+SpriteStressScene::SpriteStressScene(int spriteCount)
+    : spriteCount(spriteCount)
+{
+}
+
+bool SpriteStressScene::init(Renderer& renderer)
+{
+    const unsigned int checkerColors[textureCount] = { 0xFF3380FFu, 0xFFFF8033u, 0xFF33FF80u, 0xFFFFFFFFu };
+    for (int i = 0; i < textureCount; i++)
+    {
+        textures[i] = createCheckerTexture(16, checkerColors[i], 0xFF202020u);
+    }
+
+    //Sprites are created grouped by texture so the batcher only has to break the batch a few times a frame
+    sprites.resize(spriteCount);
+    for (int i = 0; i < spriteCount; i++)
+    {
+        Sprite& sprite = sprites[i];
+        sprite.x = (float)(rand() % 800);
+        sprite.y = (float)(rand() % 600);
+        sprite.previousX = sprite.x;
+        sprite.previousY = sprite.y;
+        sprite.velocityX = (float)(rand() % 200 - 100);
+        sprite.velocityY = (float)(rand() % 200 - 100);
+        sprite.size = 4.0f + (float)(rand() % 12);
+        sprite.color = 0xFF000000u | (unsigned int)(rand() & 0xFFFFFF);
+        sprite.texture = i * textureCount / spriteCount;
+    }
+    stats.objects = (unsigned int)spriteCount;
+    return true;
+}
+
+void SpriteStressScene::update(float step, int width, int height)
+{
+    for (Sprite& sprite : sprites)
+    {
+        sprite.previousX = sprite.x;
+        sprite.previousY = sprite.y;
+        sprite.x += sprite.velocityX * step;
+        sprite.y += sprite.velocityY * step;
+        //A sprite that went past an edge is put back on it, otherwise a big step or a shrinking window leaves it
+        //outside and it flips back and forth there instead of bouncing
+        float maxX = std::max(width - sprite.size, 0.0f);
+        float maxY = std::max(height - sprite.size, 0.0f);
+        if (sprite.x < 0.0f || sprite.x > maxX)
+        {
+            sprite.velocityX = sprite.x < 0.0f ? std::abs(sprite.velocityX) : -std::abs(sprite.velocityX);
+            sprite.x = std::min(std::max(sprite.x, 0.0f), maxX);
+        }
+        if (sprite.y < 0.0f || sprite.y > maxY)
+        {
+            sprite.velocityY = sprite.y < 0.0f ? std::abs(sprite.velocityY) : -std::abs(sprite.velocityY);
+            sprite.y = std::min(std::max(sprite.y, 0.0f), maxY);
+        }
+    }
+}
+
+void SpriteStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    SpriteBatch& batch = buffer.sprites;
+    batch.begin((float)buffer.width, (float)buffer.height);
+    for (const Sprite& sprite : sprites)
+    {
+        float x = sprite.previousX + (sprite.x - sprite.previousX) * alpha;
+        float y = sprite.previousY + (sprite.y - sprite.previousY) * alpha;
+        batch.draw(textures[sprite.texture], x, y, sprite.size, sprite.size, sprite.color);
+    }
+}
+
+void SpriteStressScene::shutdown(Renderer& renderer)
+{
+    for (unsigned int texture : textures)
+    {
+        glState().deleteTexture(texture);
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+
+#include <vector>
+
+//Bounces a large number of small sprites around the window to stress the sprite batcher
+class SpriteStressScene : public Scene
+{
+public:
+    explicit SpriteStressScene(int spriteCount);
+
+    const char* getName() const override { return "sprites"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    static const int textureCount = 4;
+
+    struct Sprite
+    {
+        float x, y;
+        //Where the sprite was a step ago, record interpolates from here
+        float previousX, previousY;
+        float velocityX, velocityY;
+        float size;
+        unsigned int color;
+        int texture;
+    };
+
+    int spriteCount;
+    std::vector<Sprite> sprites;
+    unsigned int textures[textureCount] = {};
+};
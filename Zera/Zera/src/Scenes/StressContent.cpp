@@ -0,0 +1,166 @@
+#include "Scenes/StressContent.h"
+
+#include <cmath>
+
+const char* const stressVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec2 aUV;\n"
+"layout (location = 2) in vec4 aColor;\n"
+"layout (location = 8) in vec2 aNormal;\n"
+"out vec2 vUV;\n"
+"out vec4 vColor;\n"
+"out vec3 vNormal;\n"
+"out vec2 vPosition;\n"
+"#ifdef LIGHT_COUNT\n"
+"flat out float vLightTime;\n"
+"#endif\n"
+"void main()\n"
+"{\n"
+"   DrawData draw = draws[DRAW_INDEX];\n"
+"#ifdef LIGHT_COUNT\n"
+"   //The lit surface is opaque, its draw color's alpha carries the simulation time for the lights instead\n"
+"   vLightTime = draw.color.a;\n"
+"   draw.color.a = 1.0;\n"
+"#endif\n"
+"   vec3 normal = normalize(mat3(draw.transform) * decodeOctahedral(aNormal));\n"
+"   float light = 0.65 + 0.35 * max(dot(normal, vec3(-0.36, 0.48, 0.8)), 0.0);\n"
+"   vUV = aUV;\n"
+"   vNormal = normal;\n"
+"   vColor = draw.color * material.color * aColor * vec4(vec3(light), 1.0);\n"
+"   gl_Position = view.viewProjection * draw.transform * vec4(aPos, 1.0);\n"
+"   vPosition = gl_Position.xy / gl_Position.w;\n"
+"}\0";
+
+const char* const stressFragmentShaderSource = "#version 330 core\n"
+"in vec2 vUV;\n"
+"in vec4 vColor;\n"
+"in vec3 vNormal;\n"
+"in vec2 vPosition;\n"
+"#ifdef LIGHT_COUNT\n"
+"flat in float vLightTime;\n"
+"#endif\n"
+"uniform sampler2D uTexture;\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"   vec4 texel = texture(uTexture, vUV);\n"
+"   vec3 color = texel.rgb * (1.0 - 0.04 * float(VARIANT % 8)) * vColor.rgb;\n"
+"#ifdef LIGHT_COUNT\n"
+"   //Each light circles its own point of the screen, where and how fast comes from its index, so nothing has\n"
+"   //to be uploaded and the cost is all in the loop\n"
+"   vec3 lit = color * 0.15;\n"
+"   vec3 normal = normalize(vNormal);\n"
+"   for (int i = 0; i < LIGHT_COUNT; i++)\n"
+"   {\n"
+"      float seed = float(i) * 12.9898;\n"
+"      vec2 center = fract(vec2(sin(seed) * 43758.5453, sin(seed * 1.7) * 24634.6345)) * 2.0 - 1.0;\n"
+"      float speed = 0.3 + fract(seed * 0.618) * 1.2;\n"
+"      vec2 orbit = vec2(cos(vLightTime * speed + seed), sin(vLightTime * speed + seed)) * 0.25;\n"
+"      vec3 toLight = vec3(center + orbit - vPosition, 0.2);\n"
+"      float falloff = 1.0 / (1.0 + 60.0 * dot(toLight, toLight));\n"
+"      vec3 lightColor = 0.5 + 0.5 * cos(vec3(0.0, 2.1, 4.2) + seed);\n"
+"      lit += color * lightColor * falloff * max(dot(normal, normalize(toLight)), 0.0);\n"
+"   }\n"
+"   color = lit;\n"
+"#endif\n"
+"   FragColor = vec4(color, texel.a * vColor.a);\n"
+"}\n\0";
+
+MeshData ProceduralMesh::data() const
+{
+    MeshData mesh;
+    mesh.positions = positions.data();
+    mesh.texCoords = texCoords.data();
+    mesh.normals = normals.data();
+    mesh.colors = colors.data();
+    mesh.vertexCount = (unsigned int)(positions.size() / 3);
+    mesh.indices = indices.data();
+    mesh.indexCount = (unsigned int)indices.size();
+    return mesh;
+}
+
+void pillowNormals(const float* positions, unsigned int vertexCount, float* normals)
+{
+    for (unsigned int i = 0; i < vertexCount; i++)
+    {
+        float x = positions[i * 3 + 0];
+        float y = positions[i * 3 + 1];
+        float length = std::sqrt(x * x + y * y + 1.0f);
+        normals[i * 3 + 0] = x / length;
+        normals[i * 3 + 1] = y / length;
+        normals[i * 3 + 2] = 1.0f / length;
+    }
+}
+
+ProceduralMesh makePolygon(unsigned int corners, float ripple)
+{
+    ProceduralMesh mesh;
+    //The center comes first and is a little brighter than the rim
+    unsigned int vertexCount = corners + 1;
+    mesh.positions.reserve(vertexCount * 3);
+    mesh.texCoords.reserve(vertexCount * 2);
+    mesh.colors.reserve(vertexCount * 4);
+    mesh.positions.insert(mesh.positions.end(), { 0.0f, 0.0f, 0.0f });
+    mesh.texCoords.insert(mesh.texCoords.end(), { 0.5f, 0.5f });
+    mesh.colors.insert(mesh.colors.end(), { 1.0f, 1.0f, 1.0f, 1.0f });
+    for (unsigned int i = 0; i < corners; i++)
+    {
+        float angle = 6.2831853f * i / corners;
+        float radius = 0.5f * ((i & 1) ? 1.0f - ripple : 1.0f);
+        float x = cosf(angle) * radius;
+        float y = sinf(angle) * radius;
+        mesh.positions.insert(mesh.positions.end(), { x, y, 0.0f });
+        mesh.texCoords.insert(mesh.texCoords.end(), { x + 0.5f, y + 0.5f });
+        mesh.colors.insert(mesh.colors.end(), { 0.75f, 0.75f, 0.75f, 1.0f });
+    }
+    mesh.indices.reserve(corners * 3);
+    for (unsigned int i = 0; i < corners; i++)
+    {
+        mesh.indices.insert(mesh.indices.end(), { 0u, 1 + i, 1 + (i + 1) % corners });
+    }
+    mesh.normals.resize(vertexCount * 3);
+    pillowNormals(mesh.positions.data(), vertexCount, mesh.normals.data());
+    return mesh;
+}
+
+ProceduralMesh makeGrid(unsigned int columns, unsigned int rows)
+{
+    ProceduralMesh mesh;
+    unsigned int vertexCount = (columns + 1) * (rows + 1);
+    mesh.positions.reserve(vertexCount * 3);
+    mesh.texCoords.reserve(vertexCount * 2);
+    mesh.normals.reserve(vertexCount * 3);
+    mesh.colors.reserve(vertexCount * 4);
+    //The surface is z = a sin(kx) cos(ky), its normal is (-dz/dx, -dz/dy, 1) normalized
+    const float amplitude = 0.02f;
+    const float frequency = 25.0f;
+    for (unsigned int row = 0; row <= rows; row++)
+    {
+        for (unsigned int column = 0; column <= columns; column++)
+        {
+            float u = (float)column / columns;
+            float v = (float)row / rows;
+            float x = u - 0.5f;
+            float y = v - 0.5f;
+            float z = amplitude * sinf(frequency * x) * cosf(frequency * y);
+            float dx = amplitude * frequency * cosf(frequency * x) * cosf(frequency * y);
+            float dy = -amplitude * frequency * sinf(frequency * x) * sinf(frequency * y);
+            float length = std::sqrt(dx * dx + dy * dy + 1.0f);
+            mesh.positions.insert(mesh.positions.end(), { x, y, z });
+            mesh.texCoords.insert(mesh.texCoords.end(), { u, v });
+            mesh.normals.insert(mesh.normals.end(), { -dx / length, -dy / length, 1.0f / length });
+            mesh.colors.insert(mesh.colors.end(), { 0.6f + 0.4f * u, 0.6f + 0.4f * v, 1.0f, 1.0f });
+        }
+    }
+    mesh.indices.reserve(columns * rows * 6);
+    for (unsigned int row = 0; row < rows; row++)
+    {
+        for (unsigned int column = 0; column < columns; column++)
+        {
+            unsigned int corner = row * (columns + 1) + column;
+            unsigned int above = corner + columns + 1;
+            mesh.indices.insert(mesh.indices.end(), { corner, corner + 1, above, corner + 1, above + 1, above });
+        }
+    }
+    return mesh;
+}
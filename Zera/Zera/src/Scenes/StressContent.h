@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Renderer/Mesh.h"
+
+#include <vector>
+
+//Building blocks the procedural stress scenes share: generated meshes in the queue's vertex format (positions,
+//UVs, colors and normals) and the shader that draws them through the render queue.
+
+//Generated geometry kept on the CPU until it is uploaded, data() points a MeshData at it
+struct ProceduralMesh
+{
+    std::vector<float> positions;
+    std::vector<float> texCoords;
+    std::vector<float> normals;
+    std::vector<float> colors;
+    std::vector<unsigned int> indices;
+
+    MeshData data() const;
+};
+
+//This points each vertex's normal away from the mesh center and tilts it towards the viewer
+void pillowNormals(const float* positions, unsigned int vertexCount, float* normals);
+
+//A flat polygon of radius 0.5 fanned around its center. ripple between 0 and 1 pulls every other corner in, so
+//the same corner count can be anything from a regular polygon to a spiky star.
+ProceduralMesh makePolygon(unsigned int corners, float ripple);
+//A columns x rows grid of quads over -0.5..0.5, two triangles each, with a rippled surface so the lighting shows
+//off the triangle density
+ProceduralMesh makeGrid(unsigned int columns, unsigned int rows);
+
+//Vertex and fragment shader for meshes in the queue's vertex format. Transform and color come from the draw's
+//DrawConstants entry, the fragment shader samples uTexture and tints by VARIANT, which the scenes define to make
+//different programs out of the same source. With LIGHT_COUNT defined the fragment shader also adds that many
+//point lights, animated by the simulation time in the draw color's alpha, see LightStressScene.
+extern const char* const stressVertexShaderSource;
+extern const char* const stressFragmentShaderSource;
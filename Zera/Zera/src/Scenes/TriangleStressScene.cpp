@@ -0,0 +1,89 @@
+#include "Scenes/TriangleStressScene.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/GLStateCache.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/ShaderManager.h"
+#include "Renderer/Texture.h"
+#include "Scenes/StressContent.h"
+
+#include <cmath>
+
+TriangleStressScene::TriangleStressScene(int triangleCount)
+    : triangleCount(triangleCount)
+{
+}
+
+bool TriangleStressScene::init(Renderer& renderer)
+{
+    program = shaderManager().submit("stress triangles", stressVertexShaderSource, stressFragmentShaderSource, "#define VARIANT 0\n");
+    if (!program)
+    {
+        return false;
+    }
+    texture = createCheckerTexture(16, 0xFFFFFFFFu, 0xFF606060u);
+
+    //A square grid has two triangles per cell, so the side is the square root of half the count, rounded up
+    unsigned int side = (unsigned int)std::ceil(std::sqrt(triangleCount / 2.0));
+    ProceduralMesh geometry = makeGrid(side, side);
+    mesh = createMesh(geometry.data());
+    if (!shaderManager().validateVertexInputs(program, mesh.VAO, "stress grid"))
+    {
+        return false;
+    }
+    stats.objects = mesh.indexCount / 3;
+    return true;
+}
+
+void TriangleStressScene::update(float step, int width, int height)
+{
+    previousAngle = angle;
+    angle += 0.2f * step;
+}
+
+void TriangleStressScene::record(CommandBuffer& buffer, float alpha)
+{
+    RenderQueue& queue = buffer.queue;
+
+    float aspect = (float)buffer.height / (float)buffer.width;
+    float viewProjection[16] = {};
+    viewProjection[0] = aspect;
+    viewProjection[5] = 1.0f;
+    viewProjection[10] = 1.0f;
+    viewProjection[15] = 1.0f;
+    queue.setViewProjection(viewProjection);
+
+    //The grid turns slowly in the screen plane, covering most of the window at any angle
+    float current = previousAngle + (angle - previousAngle) * alpha;
+    float c = cosf(current) * 1.6f;
+    float s = sinf(current) * 1.6f;
+    DrawConstants constants = {};
+    constants.transform[0] = c;
+    constants.transform[1] = s;
+    constants.transform[4] = -s;
+    constants.transform[5] = c;
+    constants.transform[10] = 1.0f;
+    constants.transform[15] = 1.0f;
+    for (int channel = 0; channel < 4; channel++)
+    {
+        constants.color[channel] = 1.0f;
+    }
+
+    GeometryRange range = getMeshRange(mesh);
+    RenderCommand command = {};
+    command.sortKey = SortKey::opaque(0, 0, 0, 0.5f);
+    command.program = program;
+    command.texture = texture;
+    command.material = queue.addMaterial({ { 1.0f, 1.0f, 1.0f, 1.0f } });
+    command.vertexArray = mesh.VAO;
+    command.indexCount = mesh.indexCount;
+    command.firstIndex = range.firstIndex;
+    command.baseVertex = range.baseVertex;
+    queue.push(command, constants);
+}
+
+void TriangleStressScene::shutdown(Renderer& renderer)
+{
+    shaderManager().release(program);
+    glState().deleteTexture(texture);
+    destroyMesh(mesh);
+}
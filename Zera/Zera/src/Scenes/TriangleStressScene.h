@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Scenes/Scene.h"
+#include "Renderer/Mesh.h"
+
+//Draws one procedurally generated grid mesh of about triangleCount triangles with a single draw call, so the frame
+//is all vertex work and rasterization and none of it is submission
+class TriangleStressScene : public Scene
+{
+public:
+    explicit TriangleStressScene(int triangleCount);
+
+    const char* getName() const override { return "triangles"; }
+    bool init(Renderer& renderer) override;
+    void update(float step, int width, int height) override;
+    void record(CommandBuffer& buffer, float alpha) override;
+    void shutdown(Renderer& renderer) override;
+
+private:
+    int triangleCount;
+    float angle = 0.0f;
+    //The angle a step ago, record interpolates from here
+    float previousAngle = 0.0f;
+    unsigned int program = 0;
+    unsigned int texture = 0;
+    Mesh mesh;
+};